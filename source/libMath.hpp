@@ -24,14 +24,39 @@
 #ifndef LIB_MATH_HPP
 #define LIB_MATH_HPP
 
+#include "libMath_bulk.hpp"
+#include "libMath_clip.hpp"
 #include "libMath_conversion.hpp"
+#include "libMath_curve.hpp"
+#include "libMath_decompose.hpp"
 #include "libMath_defines.hpp"
+#include "libMath_eigen.hpp"
+#include "libMath_expression.hpp"
+#include "libMath_grid.hpp"
 #include "libMath_includes.hpp"
+#include "libMath_instrument.hpp"
+#include "libMath_integrate.hpp"
+#include "libMath_kdtree.hpp"
 #include "libMath_matrix.hpp"
+#include "libMath_mesh.hpp"
+#include "libMath_morton.hpp"
+#include "libMath_noise.hpp"
+#include "libMath_obb.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_project.hpp"
 #include "libMath_quaternion.hpp"
+#include "libMath_radix.hpp"
+#include "libMath_random.hpp"
+#include "libMath_relative.hpp"
+#include "libMath_simd.hpp"
+#include "libMath_skinning.hpp"
+#include "libMath_solve.hpp"
+#include "libMath_svd.hpp"
+#include "libMath_track.hpp"
 #include "libMath_transform.hpp"
 #include "libMath_vector.hpp"
 #include "libMath_version.hpp"
+#include "libMath_weld.hpp"
 
 #endif //LIB_MATH_HPP
 
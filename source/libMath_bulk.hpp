@@ -0,0 +1,116 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_BULK_HPP
+#define LIB_MATH_BULK_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+
+#include <cstring>
+
+// Bulk copy and fill of trivially copyable vector / matrix arrays, e.g. GPU upload or network buffers.
+
+template<typename T>
+void bulkCopy(T *_dst, const T *_src, const size_t _count)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "bulkCopy requires a trivially copyable type");
+    if (_count > 0)
+    {
+        std::memcpy(_dst, _src, _count * sizeof(T));
+    }
+}
+
+template<typename T>
+void bulkMove(T *_dst, const T *_src, const size_t _count)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "bulkMove requires a trivially copyable type");
+    if (_count > 0)
+    {
+        std::memmove(_dst, _src, _count * sizeof(T));
+    }
+}
+
+// raw bytes in and out, e.g. a mapped GPU buffer
+template<typename T>
+void bulkStore(void *_dst, const T *_src, const size_t _count)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "bulkStore requires a trivially copyable type");
+    if (_count > 0)
+    {
+        std::memcpy(_dst, _src, _count * sizeof(T));
+    }
+}
+
+template<typename T>
+void bulkLoad(T *_dst, const void *_src, const size_t _count)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "bulkLoad requires a trivially copyable type");
+    if (_count > 0)
+    {
+        std::memcpy(_dst, _src, _count * sizeof(T));
+    }
+}
+
+template<typename T>
+void bulkZero(T *_dst, const size_t _count)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "bulkZero requires a trivially copyable type");
+    if (_count > 0)
+    {
+        std::memset(static_cast<void *>(_dst), 0, _count * sizeof(T));
+    }
+}
+
+// all zero bytes become a memset, otherwise the filled prefix is doubled with memcpy
+template<typename T>
+void bulkFill(T *_dst, const T &_value, const size_t _count)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "bulkFill requires a trivially copyable type");
+    if (_count == 0)
+    {
+        return;
+    }
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &_value, sizeof(T));
+    bool zero = true;
+    for (size_t i = 0; i < sizeof(T); i++)
+    {
+        zero = zero && (bytes[i] == 0);
+    }
+    if (zero)
+    {
+        std::memset(static_cast<void *>(_dst), 0, _count * sizeof(T));
+        return;
+    }
+    std::memcpy(_dst, &_value, sizeof(T));
+    size_t filled = 1;
+    while (filled < _count)
+    {
+        const size_t chunk = (filled < (_count - filled)) ? filled : (_count - filled);
+        std::memcpy(_dst + filled, _dst, chunk * sizeof(T));
+        filled += chunk;
+    }
+}
+
+#endif // LIB_MATH_BULK_HPP
@@ -0,0 +1,295 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_CLIP_HPP
+#define LIB_MATH_CLIP_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_matrix.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_simd.hpp"
+#include "libMath_vector.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#define LIB_MATH_CLIP_PLANES 8    // planes per classify / clip call
+#define LIB_MATH_CLIP_GRAIN  4096 // minimum points / triangles per thread
+
+// Plane n . p + d = 0, the positive side is inside / in front. Distances are signed distances for
+// a unit normal (see normalized()), classification only needs the sign.
+template<typename T>
+struct plane_t
+{
+    // data structures, variables and constants
+    vec3_t<T> normal;
+    T d = 0.0;
+
+    // construnctors and destructor
+    constexpr plane_t(void) : normal(0.0, 0.0, 1.0), d(0.0) { }
+    constexpr plane_t(const vec3_t<T> &_normal, const T _d) : normal(_normal), d(_d) { }
+    constexpr plane_t(const vec4_t<T> &_v) : normal(_v.x, _v.y, _v.z), d(_v.w) { }
+    constexpr plane_t(const plane_t<T> &_p) = default;
+    ~plane_t(void) = default;
+
+    // opperators
+    constexpr plane_t<T>& operator=(const plane_t<T> &_p) = default;
+    constexpr bool operator==(const plane_t<T> &_p) const { return (normal == _p.normal) && (d == _p.d); }
+
+    // functions
+    static constexpr plane_t<T> fromPointNormal(const vec3_t<T> &_point, const vec3_t<T> &_normal) { return plane_t<T>(_normal, -_normal.dot(_point)); }
+    // counter clockwise _a, _b, _c seen from the front
+    static plane_t<T> fromPoints(const vec3_t<T> &_a, const vec3_t<T> &_b, const vec3_t<T> &_c) { return fromPointNormal(_a, (_b - _a).cross(_c - _a).normalized()); }
+    constexpr T distance(const vec3_t<T> &_p) const { return normal.dot(_p) + d; }
+    constexpr vec4_t<T> toVec4(void) const { return vec4_t<T>(normal.x, normal.y, normal.z, d); }
+    plane_t<T> normalized(void) const { const T s = static_cast<T>(1.0) / normal.length(); return plane_t<T>(normal * s, d * s); }
+};
+
+typedef plane_t<float32> plane;
+typedef plane_t<float32> planef;
+typedef plane_t<float64> planed;
+
+// Gribb / Hartmann frustum planes of a view-projection matrix, inside facing, in frustumBit order
+// (left, right, bottom, top, near, far), _ndcLow is the low end of the ndc depth range: -1 for
+// perspective(), 0 for [0, 1] depth. With reverse-Z the last two planes swap.
+template<typename T>
+void frustumPlanes(const mat4_t<T> &_viewProjection, plane_t<T> _planes[6], const T _ndcLow = -1.0)
+{
+    const mat4_t<T> &m = _viewProjection;
+    for (uint32 i = 0; i < 2; i++)
+    {
+        const T sign = (i == 0) ? static_cast<T>(1.0) : static_cast<T>(-1.0);
+        for (uint32 r = 0; r < 2; r++)
+        {
+            _planes[(r * 2) + i] = plane_t<T>(vec4_t<T>(m.data[3][0] + (sign * m.data[r][0]), m.data[3][1] + (sign * m.data[r][1]), m.data[3][2] + (sign * m.data[r][2]), m.data[3][3] + (sign * m.data[r][3]))).normalized();
+        }
+    }
+    _planes[4] = plane_t<T>(vec4_t<T>(m.data[2][0] - (_ndcLow * m.data[3][0]), m.data[2][1] - (_ndcLow * m.data[3][1]), m.data[2][2] - (_ndcLow * m.data[3][2]), m.data[2][3] - (_ndcLow * m.data[3][3]))).normalized();
+    _planes[5] = plane_t<T>(vec4_t<T>(m.data[3][0] - m.data[2][0], m.data[3][1] - m.data[2][1], m.data[3][2] - m.data[2][2], m.data[3][3] - m.data[2][3])).normalized();
+}
+
+// functions
+
+template<typename L, typename T>
+inline L planeDistance(const plane_t<T> &_plane, const L _p[3])
+{
+    return simdMadd(simdSplat<L>(_plane.normal.x), _p[0], simdMadd(simdSplat<L>(_plane.normal.y), _p[1], simdMadd(simdSplat<L>(_plane.normal.z), _p[2], simdSplat<L>(_plane.d))));
+}
+
+// signed distance of every point, multithreaded
+template<typename T>
+void planeDistances(const plane_t<T> &_plane, const vec3_t<T> *_points, const size_t _count, T *_distances)
+{
+    parallelForLanes<T>(_count, LIB_MATH_CLIP_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        L p[3];
+        simdLoadVec<L>(_points, _i, p);
+        simdStoreAt<L>(_distances, _i, planeDistance<L>(_plane, p));
+    });
+}
+
+// bit p of _outside[i] is set when point i is behind plane p, multithreaded
+template<typename T>
+void planeClassify(const plane_t<T> *_planes, const uint32 _planeCount, const vec3_t<T> *_points, const size_t _count, uint8 *_outside)
+{
+    parallelForLanes<T>(_count, LIB_MATH_CLIP_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        L p[3];
+        simdLoadVec<L>(_points, _i, p);
+        uint32 bits[LIB_MATH_CLIP_PLANES];
+        for (uint32 k = 0; k < _planeCount; k++)
+        {
+            const L behind = simdLess(planeDistance<L>(_planes[k], p), simdSplat<L>(0.0));
+            if constexpr (std::is_same<L, float32x8>::value)
+            {
+                bits[k] = simdMaskBits(behind);
+            }
+            else
+            {
+                bits[k] = behind ? 1 : 0;
+            }
+        }
+        constexpr uint32 lanes = std::is_same<L, float32x8>::value ? 8 : 1;
+        for (uint32 l = 0; l < lanes; l++)
+        {
+            uint8 outside = 0;
+            for (uint32 k = 0; k < _planeCount; k++)
+            {
+                outside |= static_cast<uint8>(((bits[k] >> l) & 1) << k);
+            }
+            _outside[_i + l] = outside;
+        }
+    });
+}
+
+// Sutherland-Hodgman step on a polygon of _count vertices with _stride values each (x, y, z,
+// attributes ...), returns the vertex count written to _out. Crossing edges are always
+// interpolated from their inside vertex, so edges shared by neighbouring triangles split at
+// bitwise identical points.
+template<typename T>
+uint32 clipPolygon(const plane_t<T> &_plane, const T *_in, const uint32 _count, T *_out, const uint32 _stride)
+{
+    uint32 count = 0;
+    for (uint32 i = 0; i < _count; i++)
+    {
+        const T *a = _in + (i * _stride);
+        const T *b = _in + (((i + 1) % _count) * _stride);
+        const T da = (_plane.normal.x * a[0]) + (_plane.normal.y * a[1]) + (_plane.normal.z * a[2]) + _plane.d;
+        const T db = (_plane.normal.x * b[0]) + (_plane.normal.y * b[1]) + (_plane.normal.z * b[2]) + _plane.d;
+        if (da >= 0.0)
+        {
+            std::copy(a, a + _stride, _out + (count++ * _stride));
+        }
+        if ((da >= 0.0) != (db >= 0.0))
+        {
+            const T *from = (da >= 0.0) ? a : b;
+            const T *to   = (da >= 0.0) ? b : a;
+            const T t = (da >= 0.0) ? (da / (da - db)) : (db / (db - da));
+            T *v = _out + (count++ * _stride);
+            for (uint32 k = 0; k < _stride; k++)
+            {
+                v[k] = from[k] + ((to[k] - from[k]) * t);
+            }
+        }
+    }
+    return count;
+}
+
+template<typename T>
+struct clipOutput_t
+{
+    std::vector<vec3_t<T>> positions; // 3 per triangle
+    std::vector<T> attributes;        // attributeCount per vertex
+    std::vector<uint32> sources;      // input triangle of each output triangle
+};
+
+// Clips packed triangles (3 positions each, _attributes holding _attributeCount values per vertex
+// or nullptr) against up to LIB_MATH_CLIP_PLANES planes, clipped polygons are fanned back into
+// triangles. Vertex distances are computed in lanes first, triangles fully inside pass through and
+// triangles fully behind one plane are dropped before the polygon clipper runs. Output keeps the
+// input order whatever the thread count.
+template<typename T>
+void clipTriangles(const plane_t<T> *_planes, const uint32 _planeCount, const vec3_t<T> *_positions, const T *_attributes, const uint32 _attributeCount, const size_t _triangleCount, clipOutput_t<T> &_out)
+{
+    const size_t chunks = std::max<size_t>(1, std::min<size_t>(parallelThreadCount(), _triangleCount / LIB_MATH_CLIP_GRAIN));
+    std::vector<clipOutput_t<T>> local(chunks);
+    const uint32 stride = 3 + _attributeCount;
+    parallelFor(chunks, 1, [&](const size_t _begin, const size_t _end)
+    {
+        std::vector<T> distances;
+        std::vector<T> polygon[2];
+        polygon[0].resize((3 + _planeCount) * stride);
+        polygon[1].resize((3 + _planeCount) * stride);
+        for (size_t c = _begin; c < _end; c++)
+        {
+            const size_t first = (_triangleCount * c) / chunks;
+            const size_t last  = (_triangleCount * (c + 1)) / chunks;
+            const size_t vertices = (last - first) * 3;
+            distances.resize(vertices * _planeCount);
+            simdForLanes<T>(first * 3, last * 3, [&](auto _lane, const size_t _i)
+            {
+                using L = decltype(_lane);
+                L p[3];
+                simdLoadVec<L>(_positions, _i, p);
+                for (uint32 k = 0; k < _planeCount; k++)
+                {
+                    simdStoreAt<L>(distances.data(), (k * vertices) + (_i - (first * 3)), planeDistance<L>(_planes[k], p));
+                }
+            });
+            clipOutput_t<T> &out = local[c];
+            for (size_t t = first; t < last; t++)
+            {
+                const size_t v = (t - first) * 3;
+                bool inside   = true;
+                bool rejected = false;
+                for (uint32 k = 0; k < _planeCount; k++)
+                {
+                    const T *d = distances.data() + (k * vertices) + v;
+                    inside   = inside && (d[0] >= 0.0) && (d[1] >= 0.0) && (d[2] >= 0.0);
+                    rejected = rejected || ((d[0] < 0.0) && (d[1] < 0.0) && (d[2] < 0.0));
+                }
+                if (rejected)
+                {
+                    continue;
+                }
+                if (inside)
+                {
+                    out.positions.insert(out.positions.end(), _positions + (t * 3), _positions + (t * 3) + 3);
+                    if (_attributes != nullptr)
+                    {
+                        out.attributes.insert(out.attributes.end(), _attributes + (t * 3 * _attributeCount), _attributes + ((t + 1) * 3 * _attributeCount));
+                    }
+                    out.sources.push_back(static_cast<uint32>(t));
+                    continue;
+                }
+                for (uint32 i = 0; i < 3; i++)
+                {
+                    T *dst = polygon[0].data() + (i * stride);
+                    for (uint32 k = 0; k < 3; k++)
+                    {
+                        dst[k] = _positions[(t * 3) + i][k];
+                    }
+                    for (uint32 k = 0; k < _attributeCount; k++)
+                    {
+                        dst[3 + k] = (_attributes != nullptr) ? _attributes[(((t * 3) + i) * _attributeCount) + k] : static_cast<T>(0.0);
+                    }
+                }
+                uint32 count = 3;
+                uint32 current = 0;
+                for (uint32 k = 0; (k < _planeCount) && (count >= 3); k++)
+                {
+                    count = clipPolygon(_planes[k], polygon[current].data(), count, polygon[1 - current].data(), stride);
+                    current = 1 - current;
+                }
+                for (uint32 i = 1; (i + 1) < count; i++)
+                {
+                    const uint32 fan[3] = { 0, i, i + 1 };
+                    for (uint32 j = 0; j < 3; j++)
+                    {
+                        const T *src = polygon[current].data() + (fan[j] * stride);
+                        out.positions.push_back(vec3_t<T>(src[0], src[1], src[2]));
+                        if (_attributes != nullptr)
+                        {
+                            out.attributes.insert(out.attributes.end(), src + 3, src + stride);
+                        }
+                    }
+                    out.sources.push_back(static_cast<uint32>(t));
+                }
+            }
+        }
+    });
+    _out.positions.clear();
+    _out.attributes.clear();
+    _out.sources.clear();
+    for (size_t c = 0; c < chunks; c++)
+    {
+        _out.positions.insert(_out.positions.end(), local[c].positions.begin(), local[c].positions.end());
+        _out.attributes.insert(_out.attributes.end(), local[c].attributes.begin(), local[c].attributes.end());
+        _out.sources.insert(_out.sources.end(), local[c].sources.begin(), local[c].sources.end());
+    }
+}
+
+#endif // LIB_MATH_CLIP_HPP
@@ -23,12 +23,6 @@
 
 #include "libMath_conversion.hpp"
 
-float64 degToRad(const float64 &_deg)
-{
-    return _deg *  0.0174532925;
-}
-
-float64 radToDeg(const float64 &_rad)
-{
-    return _rad * 57.2957795131;
-}
+// compile time evaluation checks
+static_assert(degToRad(180.0) > 3.1415926 && degToRad(180.0) < 3.1415927);
+static_assert(radToDeg(M_PI) > 179.99999 && radToDeg(M_PI) < 180.00001);
@@ -26,7 +26,14 @@
 
 #include "libMath_defines.hpp"
 
-float64 degToRad(const float64 &_deg);
-float64 radToDeg(const float64 &_rad);
+constexpr float64 degToRad(const float64 &_deg)
+{
+    return _deg *  0.0174532925;
+}
+
+constexpr float64 radToDeg(const float64 &_rad)
+{
+    return _rad * 57.2957795131;
+}
 
 #endif // LIB_MATH_CONVERSION_HPP
\ No newline at end of file
@@ -0,0 +1,388 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_CURVE_HPP
+#define LIB_MATH_CURVE_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_simd.hpp"
+#include "libMath_vector.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#define LIB_MATH_CURVE_GRAIN 16384 // minimum output points per thread
+
+// Piecewise cubic curves on vec3_t. Every segment is converted to power basis
+// a * u^3 + b * u^2 + c * u + d, evaluation is Horner's rule, float32 batches run 8 parameters
+// per float32x8 against broadcast coefficients. The global parameter t runs over [0, segments()].
+//  Bezier       p0 c0 c1 p1 c2 c3 p2 ..., segments share end points
+//  Hermite      p0 m0 p1 m1 ..., position / tangent pairs
+//  Catmull-Rom  p0 p1 p2 p3 ..., passes through p1 .. pn-2
+//  B-spline     uniform cubic, approximating, C2 continuous
+enum curveType : uint32
+{
+    CURVE_BEZIER = 0,
+    CURVE_HERMITE,
+    CURVE_CATMULL_ROM,
+    CURVE_BSPLINE
+};
+
+template<typename T>
+struct curveCubic_t
+{
+    vec3_t<T> a;
+    vec3_t<T> b;
+    vec3_t<T> c;
+    vec3_t<T> d;
+
+    constexpr vec3_t<T> evaluate(const T _u) const { return (((((a * _u) + b) * _u) + c) * _u) + d; }
+    constexpr vec3_t<T> derivative(const T _u) const { return (((a * (3.0 * _u)) + (b * 2.0)) * _u) + c; }
+    constexpr vec3_t<T> secondDerivative(const T _u) const { return (a * (6.0 * _u)) + (b * 2.0); }
+};
+
+template<typename T>
+constexpr curveCubic_t<T> curveSegment(const uint32 _type, const vec3_t<T> &_p0, const vec3_t<T> &_p1, const vec3_t<T> &_p2, const vec3_t<T> &_p3)
+{
+    curveCubic_t<T> s;
+    switch (_type)
+    {
+        case CURVE_BEZIER:
+            s.a = (_p1 - _p2) * 3.0 + _p3 - _p0;
+            s.b = (_p0 + _p2) * 3.0 - _p1 * 6.0;
+            s.c = (_p1 - _p0) * 3.0;
+            s.d = _p0;
+        break;
+        case CURVE_HERMITE:
+            s.a = (_p0 - _p2) * 2.0 + _p1 + _p3;
+            s.b = (_p2 - _p0) * 3.0 - _p1 * 2.0 - _p3;
+            s.c = _p1;
+            s.d = _p0;
+        break;
+        case CURVE_CATMULL_ROM:
+            s.a = ((_p1 - _p2) * 3.0 + _p3 - _p0) * 0.5;
+            s.b = (_p0 * 2.0 - _p1 * 5.0 + _p2 * 4.0 - _p3) * 0.5;
+            s.c = (_p2 - _p0) * 0.5;
+            s.d = _p1;
+        break;
+        case CURVE_BSPLINE:
+            s.a = ((_p1 - _p2) * 3.0 + _p3 - _p0) * (1.0 / 6.0);
+            s.b = ((_p0 + _p2) * 3.0 - _p1 * 6.0) * (1.0 / 6.0);
+            s.c = (_p2 - _p0) * 0.5;
+            s.d = (_p0 + _p1 * 4.0 + _p2) * (1.0 / 6.0);
+        break;
+    }
+    return s;
+}
+
+template<typename T>
+struct curve_t
+{
+    std::vector<vec3_t<T>> points;
+    uint32 type = CURVE_CATMULL_ROM;
+
+    uint32 segments(void) const
+    {
+        const uint32 n = static_cast<uint32>(points.size());
+        if (n < 4)
+        {
+            return 0;
+        }
+        return (type == CURVE_BEZIER) ? (n - 1) / 3 : (type == CURVE_HERMITE) ? (n / 2) - 1 : n - 3;
+    }
+
+    curveCubic_t<T> segment(const uint32 _i) const
+    {
+        const uint32 first = (type == CURVE_BEZIER) ? _i * 3 : (type == CURVE_HERMITE) ? _i * 2 : _i;
+        return curveSegment(type, points[first], points[first + 1], points[first + 2], points[first + 3]);
+    }
+
+    // segment of the global parameter _t, returns the local parameter (segment 0 at 0 without segments)
+    T locate(const T _t, uint32 &_segment) const
+    {
+        const uint32 count = segments();
+        if (count == 0)
+        {
+            _segment = 0;
+            return 0.0;
+        }
+        const T t = (_t < 0.0) ? 0.0 : _t;
+        if (!(t < static_cast<T>(count))) // also NaN
+        {
+            _segment = count - 1;
+            return 1.0;
+        }
+        _segment = static_cast<uint32>(t);
+        return t - static_cast<T>(_segment);
+    }
+
+    // fewer than 4 points: evaluate returns the first point (or zero), derivative returns zero
+    vec3_t<T> evaluate(const T _t) const
+    {
+        if (segments() == 0)
+        {
+            return points.empty() ? vec3_t<T>(0.0) : points[0];
+        }
+        uint32 s = 0;
+        const T u = locate(_t, s);
+        return segment(s).evaluate(u);
+    }
+
+    vec3_t<T> derivative(const T _t) const
+    {
+        if (segments() == 0)
+        {
+            return vec3_t<T>(0.0);
+        }
+        uint32 s = 0;
+        const T u = locate(_t, s);
+        return segment(s).derivative(u);
+    }
+
+    vec3_t<T> tangent(const T _t) const { return derivative(_t).normalized(); }
+};
+
+// points (and derivatives) of one segment at u = (_first + i) * _step, i < _count
+template<typename T>
+void curveSegmentSample(const curveCubic_t<T> &_s, const uint32 _first, const uint32 _count, const T _step, vec3_t<T> *_points, vec3_t<T> *_derivatives)
+{
+    uint32 i = 0;
+    if constexpr (std::is_same<T, float32>::value)
+    {
+        alignas(32) float32 lane[3][8];
+        const float32x8 ax = simdSet(_s.a.x); const float32x8 ay = simdSet(_s.a.y); const float32x8 az = simdSet(_s.a.z);
+        const float32x8 bx = simdSet(_s.b.x); const float32x8 by = simdSet(_s.b.y); const float32x8 bz = simdSet(_s.b.z);
+        const float32x8 cx = simdSet(_s.c.x); const float32x8 cy = simdSet(_s.c.y); const float32x8 cz = simdSet(_s.c.z);
+        const float32x8 dx = simdSet(_s.d.x); const float32x8 dy = simdSet(_s.d.y); const float32x8 dz = simdSet(_s.d.z);
+        const float32x8 two   = simdSet(2.0f);
+        const float32x8 three = simdSet(3.0f);
+        for (; (i + 8) <= _count; i += 8)
+        {
+            for (uint32 l = 0; l < 8; l++)
+            {
+                lane[0][l] = static_cast<float32>(_first + i + l) * _step;
+            }
+            const float32x8 u = simdLoad(lane[0]);
+            simdStore(lane[0], simdMadd(simdMadd(simdMadd(ax, u, bx), u, cx), u, dx));
+            simdStore(lane[1], simdMadd(simdMadd(simdMadd(ay, u, by), u, cy), u, dy));
+            simdStore(lane[2], simdMadd(simdMadd(simdMadd(az, u, bz), u, cz), u, dz));
+            for (uint32 l = 0; l < 8; l++)
+            {
+                _points[i + l] = vec3_t<float32>(lane[0][l], lane[1][l], lane[2][l]);
+            }
+            if (_derivatives != nullptr)
+            {
+                simdStore(lane[0], simdMadd(simdMadd(three * ax, u, two * bx), u, cx));
+                simdStore(lane[1], simdMadd(simdMadd(three * ay, u, two * by), u, cy));
+                simdStore(lane[2], simdMadd(simdMadd(three * az, u, two * bz), u, cz));
+                for (uint32 l = 0; l < 8; l++)
+                {
+                    _derivatives[i + l] = vec3_t<float32>(lane[0][l], lane[1][l], lane[2][l]);
+                }
+            }
+        }
+    }
+    for (; i < _count; i++)
+    {
+        const T u = static_cast<T>(_first + i) * _step;
+        _points[i] = _s.evaluate(u);
+        if (_derivatives != nullptr)
+        {
+            _derivatives[i] = _s.derivative(u);
+        }
+    }
+}
+
+// _samples points per segment at u = i / _samples followed by the end point,
+// segments() * _samples + 1 outputs, _derivatives may be nullptr
+template<typename T>
+void curveSampleUniform(const curve_t<T> &_curve, const uint32 _samples, vec3_t<T> *_points, vec3_t<T> *_derivatives)
+{
+    const uint32 count = _curve.segments();
+    if ((count == 0) || (_samples == 0))
+    {
+        return;
+    }
+    const T step = 1.0 / static_cast<T>(_samples);
+    const size_t grain = (LIB_MATH_CURVE_GRAIN + _samples - 1) / _samples;
+    parallelFor(count, grain, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t s = _begin; s < _end; s++)
+        {
+            const size_t offset = s * _samples;
+            curveSegmentSample(_curve.segment(static_cast<uint32>(s)), 0, _samples, step, _points + offset, (_derivatives != nullptr) ? _derivatives + offset : nullptr);
+        }
+    });
+    const curveCubic_t<T> last = _curve.segment(count - 1);
+    _points[static_cast<size_t>(count) * _samples] = last.evaluate(1.0);
+    if (_derivatives != nullptr)
+    {
+        _derivatives[static_cast<size_t>(count) * _samples] = last.derivative(1.0);
+    }
+}
+
+// arbitrary global parameters, _derivatives may be nullptr
+template<typename T>
+void curveEvaluateBatch(const curve_t<T> &_curve, const T *_t, vec3_t<T> *_points, vec3_t<T> *_derivatives, const size_t _count)
+{
+    if (_curve.segments() == 0)
+    {
+        return;
+    }
+    parallelFor(_count, LIB_MATH_CURVE_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        uint32 current = ~0u;
+        curveCubic_t<T> s;
+        for (size_t i = _begin; i < _end; i++)
+        {
+            uint32 index = 0;
+            const T u = _curve.locate(_t[i], index);
+            if (index != current)
+            {
+                s       = _curve.segment(index);
+                current = index;
+            }
+            _points[i] = s.evaluate(u);
+            if (_derivatives != nullptr)
+            {
+                _derivatives[i] = s.derivative(u);
+            }
+        }
+    });
+}
+
+// Cumulative arc length at global parameter i * step, each interval integrated with 3 point
+// Gauss-Legendre. parameter() inverts it with a binary search and linear interpolation.
+template<typename T>
+struct curveArcLength_t
+{
+    std::vector<T> lengths;
+    T step = 0.0;
+
+    T length(void) const { return lengths.empty() ? 0.0 : lengths.back(); }
+
+    T parameter(const T _s) const
+    {
+        if (lengths.size() < 2)
+        {
+            return 0.0;
+        }
+        const size_t i = std::min<size_t>(std::upper_bound(lengths.begin(), lengths.end(), _s) - lengths.begin(), lengths.size() - 1);
+        return parameter(_s, (i > 0) ? i - 1 : 0);
+    }
+
+    // _i is the interval, lengths[_i] <= _s < lengths[_i + 1]
+    T parameter(const T _s, const size_t _i) const
+    {
+        const T span = lengths[_i + 1] - lengths[_i];
+        T f = (span > 0.0) ? (_s - lengths[_i]) / span : 0.0;
+        f = (f < 0.0) ? 0.0 : (f > 1.0) ? 1.0 : f;
+        return (static_cast<T>(_i) + f) * step;
+    }
+};
+
+template<typename T>
+curveArcLength_t<T> curveArcLengthBuild(const curve_t<T> &_curve, const uint32 _samplesPerSegment)
+{
+    const T node = 0.774596669241483; // sqrt(3 / 5)
+    const T weight[3] = { 5.0 / 9.0, 8.0 / 9.0, 5.0 / 9.0 };
+    curveArcLength_t<T> lut;
+    const uint32 count = _curve.segments();
+    const uint32 n = (_samplesPerSegment > 0) ? _samplesPerSegment : 1;
+    if (count == 0)
+    {
+        return lut;
+    }
+    lut.step = 1.0 / static_cast<T>(n);
+    lut.lengths.resize(static_cast<size_t>(count) * n + 1);
+    lut.lengths[0] = 0.0;
+    T sum = 0.0;
+    for (uint32 s = 0; s < count; s++)
+    {
+        const curveCubic_t<T> segment = _curve.segment(s);
+        for (uint32 i = 0; i < n; i++)
+        {
+            const T mid  = (static_cast<T>(i) + 0.5) * lut.step;
+            const T half = 0.5 * lut.step;
+            sum += half * ((weight[0] * segment.derivative(mid - (half * node)).length()) +
+                           (weight[1] * segment.derivative(mid).length()) +
+                           (weight[2] * segment.derivative(mid + (half * node)).length()));
+            lut.lengths[(static_cast<size_t>(s) * n) + i + 1] = sum;
+        }
+    }
+    return lut;
+}
+
+// _count points equally spaced along the curve from start to end, the table guess is refined
+// with one Newton step, _derivatives may be nullptr
+template<typename T>
+void curveSampleArcLength(const curve_t<T> &_curve, const curveArcLength_t<T> &_lut, vec3_t<T> *_points, vec3_t<T> *_derivatives, const size_t _count)
+{
+    if ((_curve.segments() == 0) || (_lut.lengths.size() < 2) || (_count == 0))
+    {
+        return;
+    }
+    const T node    = 0.774596669241483; // sqrt(3 / 5)
+    const T spacing = (_count > 1) ? _lut.length() / static_cast<T>(_count - 1) : 0.0;
+    parallelFor(_count, LIB_MATH_CURVE_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        // distances increase, the interval only walks forward
+        const size_t last = _lut.lengths.size() - 2;
+        size_t interval = std::upper_bound(_lut.lengths.begin(), _lut.lengths.end(), spacing * static_cast<T>(_begin)) - _lut.lengths.begin();
+        interval = (interval > 0) ? std::min(interval - 1, last) : 0;
+        for (size_t i = _begin; i < _end; i++)
+        {
+            const T s = spacing * static_cast<T>(i);
+            while ((interval < last) && (_lut.lengths[interval + 1] <= s))
+            {
+                interval++;
+            }
+            uint32 index = 0;
+            T u = _curve.locate(_lut.parameter(s, interval), index);
+            const curveCubic_t<T> segment = _curve.segment(index);
+            // one Newton step on the arc length from the interval start
+            const T u0    = (static_cast<T>(interval) * _lut.step) - static_cast<T>(index);
+            const T mid   = 0.5 * (u0 + u);
+            const T half  = 0.5 * (u - u0);
+            const T arc   = _lut.lengths[interval] + half * (((5.0 / 9.0) * segment.derivative(mid - (half * node)).length()) +
+                                                             ((8.0 / 9.0) * segment.derivative(mid).length()) +
+                                                             ((5.0 / 9.0) * segment.derivative(mid + (half * node)).length()));
+            const vec3_t<T> derivative = segment.derivative(u);
+            const T speed = derivative.length();
+            if (speed > 0.0)
+            {
+                u -= (arc - s) / speed;
+                u  = (u < 0.0) ? 0.0 : (u > 1.0) ? 1.0 : u;
+            }
+            _points[i] = segment.evaluate(u);
+            if (_derivatives != nullptr)
+            {
+                _derivatives[i] = segment.derivative(u);
+            }
+        }
+    });
+}
+
+#endif // LIB_MATH_CURVE_HPP
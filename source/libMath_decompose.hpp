@@ -0,0 +1,155 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_DECOMPOSE_HPP
+#define LIB_MATH_DECOMPOSE_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_matrix.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_quaternion.hpp"
+#include "libMath_vector.hpp"
+
+#include <limits>
+
+#define LIB_MATH_DECOMPOSE_GRAIN 4096 // minimum matrices per thread
+
+// Affine mat4_t split as M = T * R * H * S, H is the unit upper triangular shear
+// (xy, xz, yz) and zero for any translate / rotate / scale product. A mirroring matrix gets a
+// negative scale.x. The upper 3x3 columns are orthonormalized with Gram-Schmidt. For translate /
+// rotate / scale input recompose() reproduces M within 1e-6 (float32) / 1e-14 (float64) relative
+// to its largest 3x3 element, sheared input loses accuracy in proportion to the shear.
+// Zero scale axes keep a valid rotation, their shear is zero.
+template<typename T>
+struct decomposition_t
+{
+    vec3_t<T> translation;
+    quaternion<T> rotation = quaternion<T>(1.0, 0.0, 0.0, 0.0);
+    vec3_t<T> scale = vec3_t<T>(1.0);
+    vec3_t<T> shear;
+};
+
+template<typename T>
+decomposition_t<T> decompose(const mat4_t<T> &_m)
+{
+    const T tiny = std::numeric_limits<T>::min();
+    decomposition_t<T> d;
+    d.translation = vec3_t<T>(_m.data[0][3], _m.data[1][3], _m.data[2][3]);
+    vec3_t<T> r0(_m.data[0][0], _m.data[1][0], _m.data[2][0]);
+    vec3_t<T> r1(_m.data[0][1], _m.data[1][1], _m.data[2][1]);
+    vec3_t<T> r2(_m.data[0][2], _m.data[1][2], _m.data[2][2]);
+
+    d.scale.x = r0.length();
+    r0 = (d.scale.x > tiny) ? r0 * (1.0 / d.scale.x) : vec3_t<T>(1.0, 0.0, 0.0);
+
+    d.shear.x = r0.dot(r1);
+    r1 -= r0 * d.shear.x;
+    d.scale.y = r1.length();
+    if (d.scale.y > tiny)
+    {
+        r1 *= 1.0 / d.scale.y;
+        d.shear.x /= d.scale.y;
+    }
+    else
+    {
+        const vec3_t<T> axis = (std::fabs(r0.y) < 0.9) ? vec3_t<T>(0.0, 1.0, 0.0) : vec3_t<T>(0.0, 0.0, 1.0);
+        r1 = (axis - (r0 * r0.dot(axis))).normalized();
+        d.shear.x = 0.0;
+    }
+
+    d.shear.y = r0.dot(r2);
+    r2 -= r0 * d.shear.y;
+    d.shear.z = r1.dot(r2);
+    r2 -= r1 * d.shear.z;
+    d.scale.z = r2.length();
+    if (d.scale.z > tiny)
+    {
+        r2 *= 1.0 / d.scale.z;
+        d.shear.y /= d.scale.z;
+        d.shear.z /= d.scale.z;
+    }
+    else
+    {
+        r2 = r0.cross(r1);
+        d.shear.y = 0.0;
+        d.shear.z = 0.0;
+    }
+
+    // mirrored, flip the x axis so the remaining basis is a rotation
+    if (r0.cross(r1).dot(r2) < 0.0)
+    {
+        r0        = -r0;
+        d.scale.x = -d.scale.x;
+        d.shear.x = -d.shear.x;
+        d.shear.y = -d.shear.y;
+    }
+    d.rotation = quaternion<T>::fromRotation(r0.x, r1.x, r2.x,
+                                             r0.y, r1.y, r2.y,
+                                             r0.z, r1.z, r2.z);
+    return d;
+}
+
+template<typename T>
+constexpr mat4_t<T> recompose(const decomposition_t<T> &_d)
+{
+    const mat3_t<T> r = _d.rotation.toMat3();
+    mat4_t<T> tMat4(1);
+    for (uint32 i = 0; i < 3; i++)
+    {
+        const T c0 = r.data[i][0];
+        const T c1 = (r.data[i][0] * _d.shear.x) + r.data[i][1];
+        const T c2 = (r.data[i][0] * _d.shear.y) + (r.data[i][1] * _d.shear.z) + r.data[i][2];
+        tMat4.data[i][0] = c0 * _d.scale.x;
+        tMat4.data[i][1] = c1 * _d.scale.y;
+        tMat4.data[i][2] = c2 * _d.scale.z;
+        tMat4.data[i][3] = _d.translation[i];
+    }
+    return tMat4;
+}
+
+template<typename T>
+void decomposeBatch(const mat4_t<T> *_m, decomposition_t<T> *_d, const size_t _count)
+{
+    parallelFor(_count, LIB_MATH_DECOMPOSE_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            _d[i] = decompose(_m[i]);
+        }
+    });
+}
+
+template<typename T>
+void recomposeBatch(const decomposition_t<T> *_d, mat4_t<T> *_m, const size_t _count)
+{
+    parallelFor(_count, LIB_MATH_DECOMPOSE_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            _m[i] = recompose(_d[i]);
+        }
+    });
+}
+
+#endif // LIB_MATH_DECOMPOSE_HPP
@@ -0,0 +1,163 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_EIGEN_HPP
+#define LIB_MATH_EIGEN_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_matrix.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_simd.hpp"
+#include "libMath_svd.hpp"
+#include "libMath_vector.hpp"
+
+#include <type_traits>
+
+#define LIB_MATH_EIGEN_GRAIN 1024 // minimum matrices per thread
+
+// Eigen decomposition S = V * diag(lambda) * transpose(V) of symmetric 3x3 matrices with the
+// branch free Jacobi sweeps of libMath_svd.hpp (LIB_MATH_SVD_SWEEPS, approximate Givens rotations
+// accumulated in a quaternion). Eigenvalues are sorted descending by quarter turns, so V stays a
+// rotation, its columns are the eigenvectors. Only the upper triangle of S is read.
+
+// functions
+
+// swaps lambda P and Q when out of order, the quarter turn keeps _q a rotation
+template<uint32 P, uint32 Q, typename L>
+inline void eigenSort(L _lambda[3], L _q[4])
+{
+    const L half = simdSplat<L>(0.707106781186548); // sqrt(0.5)
+    const auto swap = simdLess(_lambda[P], _lambda[Q]);
+    simdSwap(_lambda[P], _lambda[Q], swap);
+    svdAccumulate<P, Q>(_q, simdSelect(swap, half, simdSplat<L>(1.0)), simdSelect(swap, half, simdSplat<L>(0.0)));
+}
+
+// _q is the unit quaternion of V
+template<typename L>
+void eigenLanes(const L _s[3][3], L _lambda[3], L _q[4])
+{
+    L s[3][3];
+    for (uint32 i = 0; i < 3; i++)
+    {
+        for (uint32 j = i; j < 3; j++)
+        {
+            s[i][j] = s[j][i] = _s[i][j];
+        }
+    }
+    _q[0] = simdSplat<L>(1.0);
+    _q[1] = _q[2] = _q[3] = simdSplat<L>(0.0);
+    for (uint32 sweep = 0; sweep < LIB_MATH_SVD_SWEEPS; sweep++)
+    {
+        svdJacobi<0, 1>(s, _q);
+        svdJacobi<1, 2>(s, _q);
+        svdJacobi<0, 2>(s, _q);
+    }
+    for (uint32 i = 0; i < 3; i++)
+    {
+        _lambda[i] = s[i][i];
+    }
+    eigenSort<0, 1>(_lambda, _q);
+    eigenSort<0, 2>(_lambda, _q);
+    eigenSort<1, 2>(_lambda, _q);
+    svdNormalize(_q);
+}
+
+template<typename T>
+void eigenSymmetric(const mat3_t<T> &_s, vec3_t<T> &_values, mat3_t<T> &_vectors)
+{
+    T lambda[3];
+    T q[4];
+    eigenLanes(_s.data, lambda, q);
+    svdQuatToMat(q, _vectors.data);
+    _values = vec3_t<T>(lambda[0], lambda[1], lambda[2]);
+}
+
+// float32 runs 8 matrices per lane set, multithreaded
+template<typename T>
+void eigenSymmetricBatch(const mat3_t<T> *_s, vec3_t<T> *_values, mat3_t<T> *_vectors, const size_t _count)
+{
+    parallelForLanes<T>(_count, LIB_MATH_EIGEN_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        L s[3][3];
+        L lambda[3];
+        L q[4];
+        L v[3][3];
+        if constexpr (std::is_same<L, float32x8>::value)
+        {
+            alignas(32) float32 lane[8];
+            for (uint32 r = 0; r < 3; r++)
+            {
+                for (uint32 c = r; c < 3; c++)
+                {
+                    for (uint32 l = 0; l < 8; l++)
+                    {
+                        lane[l] = _s[_i + l].data[r][c];
+                    }
+                    s[r][c] = s[c][r] = simdLoad(lane);
+                }
+            }
+        }
+        else
+        {
+            for (uint32 r = 0; r < 3; r++)
+            {
+                for (uint32 c = 0; c < 3; c++)
+                {
+                    s[r][c] = _s[_i].data[r][c];
+                }
+            }
+        }
+        eigenLanes(s, lambda, q);
+        svdQuatToMat(q, v);
+        simdStoreVec<L>(_values, _i, lambda);
+        if constexpr (std::is_same<L, float32x8>::value)
+        {
+            alignas(32) float32 lane[8];
+            for (uint32 r = 0; r < 3; r++)
+            {
+                for (uint32 c = 0; c < 3; c++)
+                {
+                    simdStore(lane, v[r][c]);
+                    for (uint32 l = 0; l < 8; l++)
+                    {
+                        _vectors[_i + l].data[r][c] = lane[l];
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (uint32 r = 0; r < 3; r++)
+            {
+                for (uint32 c = 0; c < 3; c++)
+                {
+                    _vectors[_i].data[r][c] = v[r][c];
+                }
+            }
+        }
+    });
+}
+
+#endif // LIB_MATH_EIGEN_HPP
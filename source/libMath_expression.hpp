@@ -0,0 +1,305 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_EXPRESSION_HPP
+#define LIB_MATH_EXPRESSION_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_matrix.hpp"
+#include "libMath_vector.hpp"
+
+// Opt-in expression templates, wrap operands with lazy() and evaluate() the result:
+//     vec3 v = evaluate(lazy(a) * s + lazy(b) * t - lazy(c));     // one fused pass
+//     vec4 p = evaluate(lazy(proj) * lazy(view) * lazy(model) * lazy(pos)); // three mat-vec products
+// Leaves reference their operands, so evaluate() within the same full expression.
+
+// type traits
+template<typename V> struct exprVecTraits;
+template<typename T> struct exprVecTraits<vec2_t<T>> { typedef T type; static const uint32 SIZE = 2; };
+template<typename T> struct exprVecTraits<vec3_t<T>> { typedef T type; static const uint32 SIZE = 3; };
+template<typename T> struct exprVecTraits<vec4_t<T>> { typedef T type; static const uint32 SIZE = 4; };
+
+template<typename M> struct exprMatTraits;
+template<typename T> struct exprMatTraits<mat2_t<T>> { typedef T type; typedef vec2_t<T> vec; static const uint32 SIZE = 2; };
+template<typename T> struct exprMatTraits<mat3_t<T>> { typedef T type; typedef vec3_t<T> vec; static const uint32 SIZE = 3; };
+template<typename T> struct exprMatTraits<mat4_t<T>> { typedef T type; typedef vec4_t<T> vec; static const uint32 SIZE = 4; };
+
+// element operations
+struct exprAdd { template<typename T> static constexpr T apply(const T _a, const T _b) { return _a + _b; } };
+struct exprSub { template<typename T> static constexpr T apply(const T _a, const T _b) { return _a - _b; } };
+struct exprMul { template<typename T> static constexpr T apply(const T _a, const T _b) { return _a * _b; } };
+struct exprDiv { template<typename T> static constexpr T apply(const T _a, const T _b) { return _a / _b; } };
+
+// vector expressions
+template<typename E>
+struct vecExpr
+{
+    constexpr const E& self(void) const { return static_cast<const E&>(*this); }
+};
+
+template<typename V>
+struct vecExprLeaf : vecExpr<vecExprLeaf<V>>
+{
+    typedef V vec;
+    typedef typename exprVecTraits<V>::type type;
+    static const uint32 SIZE = exprVecTraits<V>::SIZE;
+    constexpr vecExprLeaf(const V &_v) : v(_v) { }
+    constexpr type operator[](uint32 _i) const { return v[_i]; }
+    const V &v;
+};
+
+template<typename L, typename R, typename Op>
+struct vecExprBinary : vecExpr<vecExprBinary<L, R, Op>>
+{
+    typedef typename L::vec vec;
+    typedef typename L::type type;
+    static const uint32 SIZE = L::SIZE;
+    static_assert(L::SIZE == R::SIZE, "vector expression size mismatch");
+    constexpr vecExprBinary(const L &_l, const R &_r) : l(_l), r(_r) { }
+    constexpr type operator[](uint32 _i) const { return Op::apply(l[_i], r[_i]); }
+    L l;
+    R r;
+};
+
+template<typename L, typename Op>
+struct vecExprScalar : vecExpr<vecExprScalar<L, Op>>
+{
+    typedef typename L::vec vec;
+    typedef typename L::type type;
+    static const uint32 SIZE = L::SIZE;
+    constexpr vecExprScalar(const L &_l, const type _s) : l(_l), s(_s) { }
+    constexpr type operator[](uint32 _i) const { return Op::apply(l[_i], s); }
+    L l;
+    type s;
+};
+
+template<typename L>
+struct vecExprNegate : vecExpr<vecExprNegate<L>>
+{
+    typedef typename L::vec vec;
+    typedef typename L::type type;
+    static const uint32 SIZE = L::SIZE;
+    constexpr vecExprNegate(const L &_l) : l(_l) { }
+    constexpr type operator[](uint32 _i) const { return -l[_i]; }
+    L l;
+};
+
+template<typename E>
+constexpr typename E::vec evaluate(const vecExpr<E> &_e)
+{
+    typename E::vec tVec;
+    for (uint32 i = 0; i < E::SIZE; i++)
+    {
+        tVec[i] = _e.self()[i];
+    }
+    return tVec;
+}
+
+template<typename E, typename V>
+constexpr void assign(V &_v, const vecExpr<E> &_e)
+{
+    for (uint32 i = 0; i < E::SIZE; i++)
+    {
+        _v[i] = _e.self()[i];
+    }
+}
+
+// matrix expressions
+template<typename E>
+struct matExpr
+{
+    constexpr const E& self(void) const { return static_cast<const E&>(*this); }
+};
+
+template<typename M>
+struct matExprLeaf : matExpr<matExprLeaf<M>>
+{
+    typedef M mat;
+    typedef typename exprMatTraits<M>::vec vec;
+    typedef typename exprMatTraits<M>::type type;
+    static const uint32 SIZE = exprMatTraits<M>::SIZE;
+    constexpr matExprLeaf(const M &_m) : m(_m) { }
+    constexpr type at(uint32 _i, uint32 _j) const { return m.data[_i][_j]; }
+    constexpr vec applyTo(const vec &_v) const { return m * _v; }
+    constexpr mat evaluate(void) const { return m; }
+    const M &m;
+};
+
+template<typename M>
+struct matExprValue : matExpr<matExprValue<M>>
+{
+    typedef M mat;
+    typedef typename exprMatTraits<M>::vec vec;
+    typedef typename exprMatTraits<M>::type type;
+    static const uint32 SIZE = exprMatTraits<M>::SIZE;
+    constexpr matExprValue(const M &_m) : m(_m) { }
+    constexpr type at(uint32 _i, uint32 _j) const { return m.data[_i][_j]; }
+    constexpr vec applyTo(const vec &_v) const { return m * _v; }
+    constexpr mat evaluate(void) const { return m; }
+    M m;
+};
+
+// products are evaluated once when used element wise
+template<typename L, typename R> struct matExprProduct;
+template<typename E> struct matExprStore { typedef E type; };
+template<typename L, typename R> struct matExprStore<matExprProduct<L, R>> { typedef matExprValue<typename L::mat> type; };
+
+template<typename E>
+constexpr typename matExprStore<E>::type matExprStored(const E &_e)
+{
+    if constexpr (std::is_same<typename matExprStore<E>::type, E>::value)
+    {
+        return _e;
+    }
+    else
+    {
+        return typename matExprStore<E>::type(_e.evaluate());
+    }
+}
+
+template<typename L, typename R, typename Op>
+struct matExprBinary : matExpr<matExprBinary<L, R, Op>>
+{
+    typedef typename L::mat mat;
+    typedef typename L::vec vec;
+    typedef typename L::type type;
+    static const uint32 SIZE = L::SIZE;
+    static_assert(L::SIZE == R::SIZE, "matrix expression size mismatch");
+    constexpr matExprBinary(const L &_l, const R &_r) : l(matExprStored(_l)), r(matExprStored(_r)) { }
+    constexpr type at(uint32 _i, uint32 _j) const { return Op::apply(l.at(_i, _j), r.at(_i, _j)); }
+    constexpr vec applyTo(const vec &_v) const
+    {
+        vec tVec(0.0f);
+        for (uint32 i = 0; i < SIZE; i++)
+        {
+            type sum = 0;
+            for (uint32 j = 0; j < SIZE; j++)
+            {
+                sum += at(i, j) * _v[j];
+            }
+            tVec[i] = sum;
+        }
+        return tVec;
+    }
+    constexpr mat evaluate(void) const
+    {
+        mat tMat(0.0f);
+        for (uint32 i = 0; i < SIZE; i++)
+        {
+            for (uint32 j = 0; j < SIZE; j++)
+            {
+                tMat.data[i][j] = at(i, j);
+            }
+        }
+        return tMat;
+    }
+    typename matExprStore<L>::type l;
+    typename matExprStore<R>::type r;
+};
+
+template<typename L, typename Op>
+struct matExprScalar : matExpr<matExprScalar<L, Op>>
+{
+    typedef typename L::mat mat;
+    typedef typename L::vec vec;
+    typedef typename L::type type;
+    static const uint32 SIZE = L::SIZE;
+    constexpr matExprScalar(const L &_l, const type _s) : l(matExprStored(_l)), s(_s) { }
+    constexpr type at(uint32 _i, uint32 _j) const { return Op::apply(l.at(_i, _j), s); }
+    constexpr vec applyTo(const vec &_v) const { vec tVec = l.applyTo(_v); for (uint32 i = 0; i < SIZE; i++) tVec[i] = Op::apply(tVec[i], s); return tVec; }
+    constexpr mat evaluate(void) const
+    {
+        mat tMat(0.0f);
+        for (uint32 i = 0; i < SIZE; i++)
+        {
+            for (uint32 j = 0; j < SIZE; j++)
+            {
+                tMat.data[i][j] = at(i, j);
+            }
+        }
+        return tMat;
+    }
+    typename matExprStore<L>::type l;
+    type s;
+};
+
+// a chain applied to a vector runs right to left as matrix-vector products
+template<typename L, typename R>
+struct matExprProduct : matExpr<matExprProduct<L, R>>
+{
+    typedef typename L::mat mat;
+    typedef typename L::vec vec;
+    typedef typename L::type type;
+    static const uint32 SIZE = L::SIZE;
+    static_assert(L::SIZE == R::SIZE, "matrix expression size mismatch");
+    constexpr matExprProduct(const L &_l, const R &_r) : l(_l), r(_r) { }
+    constexpr vec applyTo(const vec &_v) const { return l.applyTo(r.applyTo(_v)); }
+    constexpr mat evaluate(void) const { return l.evaluate() * r.evaluate(); }
+    L l;
+    R r;
+};
+
+template<typename M, typename E>
+struct vecExprTransform : vecExpr<vecExprTransform<M, E>>
+{
+    typedef typename E::vec vec;
+    typedef typename E::type type;
+    static const uint32 SIZE = E::SIZE;
+    static_assert(M::SIZE == E::SIZE, "matrix vector expression size mismatch");
+    constexpr vecExprTransform(const M &_m, const E &_e) : v(_m.applyTo(evaluate(_e))) { }
+    constexpr type operator[](uint32 _i) const { return v[_i]; }
+    vec v;
+};
+
+template<typename E>
+constexpr typename E::mat evaluate(const matExpr<E> &_e)
+{
+    return _e.self().evaluate();
+}
+
+// entry points
+template<typename T> constexpr vecExprLeaf<vec2_t<T>> lazy(const vec2_t<T> &_v) { return vecExprLeaf<vec2_t<T>>(_v); }
+template<typename T> constexpr vecExprLeaf<vec3_t<T>> lazy(const vec3_t<T> &_v) { return vecExprLeaf<vec3_t<T>>(_v); }
+template<typename T> constexpr vecExprLeaf<vec4_t<T>> lazy(const vec4_t<T> &_v) { return vecExprLeaf<vec4_t<T>>(_v); }
+template<typename T> constexpr matExprLeaf<mat2_t<T>> lazy(const mat2_t<T> &_m) { return matExprLeaf<mat2_t<T>>(_m); }
+template<typename T> constexpr matExprLeaf<mat3_t<T>> lazy(const mat3_t<T> &_m) { return matExprLeaf<mat3_t<T>>(_m); }
+template<typename T> constexpr matExprLeaf<mat4_t<T>> lazy(const mat4_t<T> &_m) { return matExprLeaf<mat4_t<T>>(_m); }
+
+// vector operators
+template<typename L, typename R> constexpr vecExprBinary<L, R, exprAdd> operator+(const vecExpr<L> &_l, const vecExpr<R> &_r) { return vecExprBinary<L, R, exprAdd>(_l.self(), _r.self()); }
+template<typename L, typename R> constexpr vecExprBinary<L, R, exprSub> operator-(const vecExpr<L> &_l, const vecExpr<R> &_r) { return vecExprBinary<L, R, exprSub>(_l.self(), _r.self()); }
+template<typename L> constexpr vecExprScalar<L, exprMul> operator*(const vecExpr<L> &_l, const typename L::type _s) { return vecExprScalar<L, exprMul>(_l.self(), _s); }
+template<typename L> constexpr vecExprScalar<L, exprMul> operator*(const typename L::type _s, const vecExpr<L> &_l) { return vecExprScalar<L, exprMul>(_l.self(), _s); }
+template<typename L> constexpr vecExprScalar<L, exprDiv> operator/(const vecExpr<L> &_l, const typename L::type _s) { return vecExprScalar<L, exprDiv>(_l.self(), _s); }
+template<typename L> constexpr vecExprNegate<L> operator-(const vecExpr<L> &_l) { return vecExprNegate<L>(_l.self()); }
+
+// matrix operators
+template<typename L, typename R> constexpr matExprBinary<L, R, exprAdd> operator+(const matExpr<L> &_l, const matExpr<R> &_r) { return matExprBinary<L, R, exprAdd>(_l.self(), _r.self()); }
+template<typename L, typename R> constexpr matExprBinary<L, R, exprSub> operator-(const matExpr<L> &_l, const matExpr<R> &_r) { return matExprBinary<L, R, exprSub>(_l.self(), _r.self()); }
+template<typename L> constexpr matExprScalar<L, exprMul> operator*(const matExpr<L> &_l, const typename L::type _s) { return matExprScalar<L, exprMul>(_l.self(), _s); }
+template<typename L> constexpr matExprScalar<L, exprMul> operator*(const typename L::type _s, const matExpr<L> &_l) { return matExprScalar<L, exprMul>(_l.self(), _s); }
+template<typename L, typename R> constexpr matExprProduct<L, R> operator*(const matExpr<L> &_l, const matExpr<R> &_r) { return matExprProduct<L, R>(_l.self(), _r.self()); }
+template<typename M, typename E> constexpr vecExprTransform<M, E> operator*(const matExpr<M> &_m, const vecExpr<E> &_e) { return vecExprTransform<M, E>(_m.self(), _e.self()); }
+
+#endif // LIB_MATH_EXPRESSION_HPP
@@ -0,0 +1,286 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_GRID_HPP
+#define LIB_MATH_GRID_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#define LIB_MATH_GRID_GRAIN 4096 // minimum points per thread
+
+#define LIB_MATH_GRID_DIGIT 11   // bucket index bits sorted per pass
+
+// Uniform grid over a hash table of 2^n buckets (n chosen so there are at least as many buckets
+// as points, at most 2^31). build() is a stable LSD radix sort of the points by bucket index: each
+// pass counts LIB_MATH_GRID_DIGIT bits per thread chunk, prefix sums the counts digit-major /
+// chunk-minor and scatters every chunk from its own offsets, so points keep input order inside a
+// bucket and results do not depend on the thread count. Points are stored sorted by bucket,
+// queries and pair iteration walk that order. All storage is kept between builds, rebuilding with
+// the same or fewer points does not allocate. Build with a cell size of at least the query radius.
+template<typename T>
+struct spatialGrid_t
+{
+    T cellSize    = 1.0;
+    T invCellSize = 1.0;
+    uint32 mask   = 0;
+    std::vector<uint32> cellStart;    // bucket b holds sorted positions [cellStart[b], cellStart[b + 1])
+    std::vector<uint32> indices;      // original index of the point at each sorted position
+    std::vector<vec3_t<T>> points;    // positions in sorted order
+    std::vector<uint32> bucketOf;     // scratch, bucket of each point, sorted after build()
+    std::vector<uint32> bucketSwap;   // scratch, radix pass targets
+    std::vector<uint32> indexSwap;
+    std::vector<uint32> histogram;    // scratch, digit counts per chunk
+
+    // cells are clamped to +-2^30 so far away (or NaN) points stay representable
+    void cell(const vec3_t<T> &_p, int32 &_x, int32 &_y, int32 &_z) const
+    {
+        constexpr T limit = static_cast<T>(1 << 30);
+        auto coordinate = [this](const T _v) -> int32
+        {
+            const T f = std::floor(_v * invCellSize);
+            return static_cast<int32>((f > -limit) ? ((f < limit) ? f : limit) : -limit);
+        };
+        _x = coordinate(_p.x);
+        _y = coordinate(_p.y);
+        _z = coordinate(_p.z);
+    }
+
+    uint32 bucket(const int32 _x, const int32 _y, const int32 _z) const
+    {
+        uint32 h = (static_cast<uint32>(_x) * 0x8da6b343u) ^ (static_cast<uint32>(_y) * 0xd8163841u) ^ (static_cast<uint32>(_z) * 0xcb1ab31fu);
+        h ^= h >> 16;
+        return h & mask;
+    }
+
+    // at most 2^32 - 1 points
+    void build(const vec3_t<T> *_points, const size_t _count, const T _cellSize)
+    {
+        constexpr uint32 digits = 1u << LIB_MATH_GRID_DIGIT;
+        cellSize    = _cellSize;
+        invCellSize = static_cast<T>(1.0) / _cellSize;
+        uint32 bits = 0;
+        while (((static_cast<size_t>(1) << bits) < _count) && (bits < 31))
+        {
+            bits++;
+        }
+        const uint32 buckets = 1u << bits;
+        mask = buckets - 1;
+        cellStart.resize(static_cast<size_t>(buckets) + 1);
+        indices.resize(_count);
+        points.resize(_count);
+        bucketOf.resize(_count);
+        bucketSwap.resize(_count);
+        indexSwap.resize(_count);
+        const size_t chunks = std::max<size_t>(1, std::min<size_t>(parallelThreadCount(), _count / LIB_MATH_GRID_GRAIN));
+        histogram.resize(chunks * digits);
+        parallelFor(_count, LIB_MATH_GRID_GRAIN, [&](const size_t _begin, const size_t _end)
+        {
+            for (size_t i = _begin; i < _end; i++)
+            {
+                int32 x, y, z;
+                cell(_points[i], x, y, z);
+                bucketOf[i] = bucket(x, y, z);
+                indices[i]  = static_cast<uint32>(i);
+            }
+        });
+        for (uint32 shift = 0; shift < bits; shift += LIB_MATH_GRID_DIGIT)
+        {
+            std::fill(histogram.begin(), histogram.end(), 0);
+            parallelFor(chunks, 1, [&](const size_t _begin, const size_t _end)
+            {
+                for (size_t c = _begin; c < _end; c++)
+                {
+                    uint32 *counts = histogram.data() + (c * digits);
+                    const size_t end = (_count * (c + 1)) / chunks;
+                    for (size_t i = (_count * c) / chunks; i < end; i++)
+                    {
+                        counts[(bucketOf[i] >> shift) & (digits - 1)]++;
+                    }
+                }
+            });
+            bool single = false;
+            uint32 sum = 0;
+            for (uint32 d = 0; d < digits; d++)
+            {
+                const uint32 first = sum;
+                for (size_t c = 0; c < chunks; c++)
+                {
+                    const uint32 n = histogram[(c * digits) + d];
+                    histogram[(c * digits) + d] = sum;
+                    sum += n;
+                }
+                single = single || ((sum - first) == _count);
+            }
+            if (single)
+            {
+                continue;
+            }
+            parallelFor(chunks, 1, [&](const size_t _begin, const size_t _end)
+            {
+                for (size_t c = _begin; c < _end; c++)
+                {
+                    uint32 *offsets = histogram.data() + (c * digits);
+                    const size_t end = (_count * (c + 1)) / chunks;
+                    for (size_t i = (_count * c) / chunks; i < end; i++)
+                    {
+                        const uint32 o = offsets[(bucketOf[i] >> shift) & (digits - 1)]++;
+                        bucketSwap[o] = bucketOf[i];
+                        indexSwap[o]  = indices[i];
+                    }
+                }
+            });
+            bucketOf.swap(bucketSwap);
+            indices.swap(indexSwap);
+        }
+        // bucket starts from the sorted bucket indices, every bucket is written by exactly one
+        // position, then gather the positions
+        if (_count == 0)
+        {
+            std::fill(cellStart.begin(), cellStart.end(), 0);
+            return;
+        }
+        parallelFor(_count, LIB_MATH_GRID_GRAIN, [&](const size_t _begin, const size_t _end)
+        {
+            for (size_t i = _begin; i < _end; i++)
+            {
+                const uint32 first = (i == 0) ? 0 : (bucketOf[i - 1] + 1);
+                const uint32 last  = bucketOf[i];
+                for (uint32 b = first; b <= last; b++)
+                {
+                    cellStart[b] = static_cast<uint32>(i);
+                }
+                points[i] = _points[indices[i]];
+            }
+        });
+        for (size_t b = static_cast<size_t>(bucketOf[_count - 1]) + 1; b <= buckets; b++)
+        {
+            cellStart[b] = static_cast<uint32>(_count);
+        }
+    }
+
+    // distinct buckets of the 27 cells around _p, returns their count
+    uint32 neighbourBuckets(const vec3_t<T> &_p, uint32 *_buckets) const
+    {
+        int32 x, y, z;
+        cell(_p, x, y, z);
+        uint32 count = 0;
+        for (int32 dz = -1; dz <= 1; dz++)
+        {
+            for (int32 dy = -1; dy <= 1; dy++)
+            {
+                for (int32 dx = -1; dx <= 1; dx++)
+                {
+                    const uint32 b = bucket(x + dx, y + dy, z + dz);
+                    if (std::find(_buckets, _buckets + count, b) == (_buckets + count))
+                    {
+                        _buckets[count++] = b;
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+    // _func(index, distSq) for every point within _radius (_radius <= cellSize) of _q
+    template<typename F>
+    void query(const vec3_t<T> &_q, const T _radius, F &&_func) const
+    {
+        if (points.empty())
+        {
+            return;
+        }
+        const T radiusSq = _radius * _radius;
+        uint32 buckets[27];
+        const uint32 count = neighbourBuckets(_q, buckets);
+        for (uint32 n = 0; n < count; n++)
+        {
+            for (uint32 i = cellStart[buckets[n]]; i < cellStart[buckets[n] + 1]; i++)
+            {
+                const vec3_t<T> d = points[i] - _q;
+                const T distSq = (d.x * d.x) + (d.y * d.y) + (d.z * d.z);
+                if (distSq <= radiusSq)
+                {
+                    _func(indices[i], distSq);
+                }
+            }
+        }
+    }
+
+    void query(const vec3_t<T> &_q, const T _radius, std::vector<uint32> &_out) const
+    {
+        query(_q, _radius, [&_out](const uint32 _index, const T) { _out.push_back(_index); });
+    }
+};
+
+// _func(i, j, distSq) once for every pair of points closer than _radius (_radius <= cellSize),
+// i and j are original indices. Points are walked in sorted order and paired with the candidates
+// stored after them, called concurrently from the worker threads.
+template<typename T, typename F>
+void gridPairs(const spatialGrid_t<T> &_grid, const T _radius, F &&_func)
+{
+    const T radiusSq = _radius * _radius;
+    parallelFor(_grid.points.size(), LIB_MATH_GRID_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        uint32 buckets[27];
+        for (size_t a = _begin; a < _end; a++)
+        {
+            const vec3_t<T> p = _grid.points[a];
+            const uint32 count = _grid.neighbourBuckets(p, buckets);
+            for (uint32 n = 0; n < count; n++)
+            {
+                const uint32 end = _grid.cellStart[buckets[n] + 1];
+                for (uint32 b = std::max(_grid.cellStart[buckets[n]], static_cast<uint32>(a + 1)); b < end; b++)
+                {
+                    const vec3_t<T> d = _grid.points[b] - p;
+                    const T distSq = (d.x * d.x) + (d.y * d.y) + (d.z * d.z);
+                    if (distSq <= radiusSq)
+                    {
+                        _func(_grid.indices[a], _grid.indices[b], distSq);
+                    }
+                }
+            }
+        }
+    });
+}
+
+// _func(query, index, distSq) for every point within _radius of each query, multithreaded
+template<typename T, typename F>
+void gridQueryBatch(const spatialGrid_t<T> &_grid, const vec3_t<T> *_queries, const size_t _count, const T _radius, F &&_func)
+{
+    parallelFor(_count, LIB_MATH_GRID_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t q = _begin; q < _end; q++)
+        {
+            _grid.query(_queries[q], _radius, [&](const uint32 _index, const T _d) { _func(q, _index, _d); });
+        }
+    });
+}
+
+#endif // LIB_MATH_GRID_HPP
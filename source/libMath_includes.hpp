@@ -27,5 +27,6 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cmath>
+#include <type_traits>
 
 #endif // LIB_MATH_INCLUDES_HPP
\ No newline at end of file
@@ -0,0 +1,131 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#include "libMath_instrument.hpp"
+
+#include <mutex>
+#include <vector>
+
+static const char *instrumentNames[INSTRUMENT_COUNT] =
+{
+    "mat4.determinant",
+    "mat4.inverse",
+    "mat4.multiply",
+    "mat4.multiplyVec4",
+    "skin.linear",
+    "skin.dualQuaternion",
+    "rsqrt.batch",
+    "noise.batch",
+    "noise.grid"
+};
+
+// live threads and the totals of threads that have exited
+static std::mutex                      instrumentMutex;
+static std::vector<instrumentThread *> instrumentThreads;
+static instrumentSnapshot              instrumentRetired;
+
+instrumentThread::instrumentThread(void)
+{
+    std::lock_guard<std::mutex> lock(instrumentMutex);
+    instrumentThreads.push_back(this);
+}
+
+instrumentThread::~instrumentThread(void)
+{
+    std::lock_guard<std::mutex> lock(instrumentMutex);
+    for (uint32 i = 0; i < INSTRUMENT_COUNT; i++)
+    {
+        instrumentRetired.counter[i].calls    += calls[i].load(std::memory_order_relaxed);
+        instrumentRetired.counter[i].elements += elements[i].load(std::memory_order_relaxed);
+        instrumentRetired.counter[i].cycles   += cycles[i].load(std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < instrumentThreads.size(); i++)
+    {
+        if (instrumentThreads[i] == this)
+        {
+            instrumentThreads[i] = instrumentThreads.back();
+            instrumentThreads.pop_back();
+            break;
+        }
+    }
+}
+
+const char *instrumentName(const instrumentOp _op)
+{
+    return (_op < INSTRUMENT_COUNT) ? instrumentNames[_op] : "unknown";
+}
+
+instrumentSnapshot instrumentSnapshotGet(void)
+{
+    std::lock_guard<std::mutex> lock(instrumentMutex);
+    instrumentSnapshot snapshot = instrumentRetired;
+    for (size_t t = 0; t < instrumentThreads.size(); t++)
+    {
+        for (uint32 i = 0; i < INSTRUMENT_COUNT; i++)
+        {
+            snapshot.counter[i].calls    += instrumentThreads[t]->calls[i].load(std::memory_order_relaxed);
+            snapshot.counter[i].elements += instrumentThreads[t]->elements[i].load(std::memory_order_relaxed);
+            snapshot.counter[i].cycles   += instrumentThreads[t]->cycles[i].load(std::memory_order_relaxed);
+        }
+    }
+    return snapshot;
+}
+
+// counters of other threads are cleared without stopping them, increments racing the reset may be lost
+void instrumentReset(void)
+{
+    std::lock_guard<std::mutex> lock(instrumentMutex);
+    instrumentRetired = instrumentSnapshot();
+    for (size_t t = 0; t < instrumentThreads.size(); t++)
+    {
+        for (uint32 i = 0; i < INSTRUMENT_COUNT; i++)
+        {
+            instrumentThreads[t]->calls[i].store(0, std::memory_order_relaxed);
+            instrumentThreads[t]->elements[i].store(0, std::memory_order_relaxed);
+            instrumentThreads[t]->cycles[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+std::string instrumentJson(const instrumentSnapshot &_snapshot)
+{
+    std::string json = "{";
+    for (uint32 i = 0; i < INSTRUMENT_COUNT; i++)
+    {
+        const instrumentCounter &c = _snapshot.counter[i];
+        json += (i > 0) ? ",\n  \"" : "\n  \"";
+        json += instrumentNames[i];
+        json += "\": { \"calls\": " + std::to_string(c.calls);
+        json += ", \"elements\": " + std::to_string(c.elements);
+        json += ", \"cycles\": " + std::to_string(c.cycles);
+        json += ", \"cyclesPerCall\": " + std::to_string((c.calls > 0) ? (c.cycles / c.calls) : 0);
+        json += ", \"elementsPerCall\": " + std::to_string((c.calls > 0) ? (c.elements / c.calls) : 0) + " }";
+    }
+    json += "\n}\n";
+    return json;
+}
+
+std::string instrumentJson(void)
+{
+    return instrumentJson(instrumentSnapshotGet());
+}
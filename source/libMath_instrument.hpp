@@ -0,0 +1,115 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_INSTRUMENT_HPP
+#define LIB_MATH_INSTRUMENT_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_simd.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+// Hot path instrumentation, compiled out unless LIB_MATH_INSTRUMENT is defined (e.g. -DLIB_MATH_INSTRUMENT).
+// Each thread counts calls, elements (batch sizes) and cycles per operation, cycles are inclusive of
+// nested instrumented calls and are TSC ticks on x86, nanoseconds elsewhere.
+// instrumentSnapshotGet() / instrumentJson() sum all threads and are available in every build.
+
+enum instrumentOp : uint32
+{
+    INSTRUMENT_MAT4_DETERMINANT = 0,
+    INSTRUMENT_MAT4_INVERSE,
+    INSTRUMENT_MAT4_MULTIPLY,
+    INSTRUMENT_MAT4_MULTIPLY_VEC4,
+    INSTRUMENT_SKIN_LINEAR,
+    INSTRUMENT_SKIN_DUAL_QUATERNION,
+    INSTRUMENT_RSQRT_BATCH,
+    INSTRUMENT_NOISE_BATCH,
+    INSTRUMENT_NOISE_GRID,
+    INSTRUMENT_COUNT
+};
+
+struct instrumentCounter
+{
+    uint64 calls    = 0;
+    uint64 elements = 0;
+    uint64 cycles   = 0;
+};
+
+struct instrumentSnapshot
+{
+    instrumentCounter counter[INSTRUMENT_COUNT];
+};
+
+// per thread counters, single writer so relaxed load / store is enough
+struct instrumentThread
+{
+    std::atomic<uint64> calls[INSTRUMENT_COUNT]    = {};
+    std::atomic<uint64> elements[INSTRUMENT_COUNT] = {};
+    std::atomic<uint64> cycles[INSTRUMENT_COUNT]   = {};
+    instrumentThread(void);
+    ~instrumentThread(void);
+};
+
+const char *instrumentName(const instrumentOp _op);
+instrumentSnapshot instrumentSnapshotGet(void);
+void instrumentReset(void);
+std::string instrumentJson(void);
+std::string instrumentJson(const instrumentSnapshot &_snapshot);
+
+inline uint64 instrumentCycles(void)
+{
+#if defined(LIB_MATH_SSE)
+    return __rdtsc();
+#else
+    return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+inline void instrumentRecord(const instrumentOp _op, const uint64 _elements, const uint64 _cycles)
+{
+    thread_local instrumentThread local;
+    local.calls[_op].store(local.calls[_op].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    local.elements[_op].store(local.elements[_op].load(std::memory_order_relaxed) + _elements, std::memory_order_relaxed);
+    local.cycles[_op].store(local.cycles[_op].load(std::memory_order_relaxed) + _cycles, std::memory_order_relaxed);
+}
+
+// literal type so it can sit in constexpr functions, does nothing during constant evaluation
+struct instrumentScope
+{
+    constexpr instrumentScope(const instrumentOp _op, const uint64 _elements) : op(_op), elements(_elements), start(0) { if (!std::is_constant_evaluated()) start = instrumentCycles(); }
+    constexpr ~instrumentScope(void) { if (!std::is_constant_evaluated()) instrumentRecord(op, elements, instrumentCycles() - start); }
+    instrumentOp op;
+    uint64 elements;
+    uint64 start;
+};
+
+#if defined(LIB_MATH_INSTRUMENT)
+    #define LIB_MATH_INSTRUMENT_SCOPE(_op, _elements) instrumentScope instrumentScopeLocal((_op), static_cast<uint64>(_elements))
+#else
+    #define LIB_MATH_INSTRUMENT_SCOPE(_op, _elements)
+#endif
+
+#endif // LIB_MATH_INSTRUMENT_HPP
@@ -0,0 +1,268 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_INTEGRATE_HPP
+#define LIB_MATH_INTEGRATE_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_simd.hpp"
+#include "libMath_vector.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+#define LIB_MATH_INTEGRATE_GRAIN 8192 // minimum bodies per thread
+
+// Batch integrators over structure of arrays state, one array per component. float32 state runs
+// 8 bodies per float32x8 with a scalar tail, float64 runs scalar lanes, all loops are spread over
+// threads. Acceleration is gravity + force * inverseMass (+ a callback for RK4). Damping scales
+// velocity by exp(-damping * dt) after the step, speeds above maxSpeed are scaled down to it.
+
+template<typename T>
+struct integrateState_t
+{
+    T *position[3]        = { nullptr, nullptr, nullptr };
+    T *velocity[3]        = { nullptr, nullptr, nullptr };
+    const T *force[3]     = { nullptr, nullptr, nullptr }; // optional
+    const T *inverseMass  = nullptr;                       // optional, 1 when absent
+    T *orientation[4]     = { nullptr, nullptr, nullptr, nullptr }; // quaternion s, x, y, z
+    T *angularVelocity[3] = { nullptr, nullptr, nullptr }; // world space, radians per second
+    size_t count          = 0;
+};
+
+template<typename T>
+struct integrateParams_t
+{
+    vec3_t<T> gravity = vec3_t<T>(0.0);
+    T damping         = 0.0; // per second
+    T angularDamping  = 0.0; // per second
+    T maxSpeed        = 0.0; // 0 disables the clamp
+    T maxAngularSpeed = 0.0; // 0 disables the clamp
+};
+
+// functions
+
+template<typename L, typename T>
+inline void integrateAcceleration(const integrateState_t<T> &_state, const integrateParams_t<T> &_params, const size_t _i, L _a[3])
+{
+    for (uint32 k = 0; k < 3; k++)
+    {
+        _a[k] = simdSplat<L>(_params.gravity[k]);
+    }
+    if (_state.force[0] != nullptr)
+    {
+        const L m = (_state.inverseMass != nullptr) ? simdLoadAt<L>(_state.inverseMass, _i) : simdSplat<L>(1.0);
+        for (uint32 k = 0; k < 3; k++)
+        {
+            _a[k] = simdMadd(simdLoadAt<L>(_state.force[k], _i), m, _a[k]);
+        }
+    }
+}
+
+// exp(-_damping * _dt), then scaled down to _maxSpeed
+template<typename L, typename T>
+inline void integrateLimit(L _v[3], const T _decay, const T _maxSpeed)
+{
+    const L decay = simdSplat<L>(_decay);
+    for (uint32 k = 0; k < 3; k++)
+    {
+        _v[k] = _v[k] * decay;
+    }
+    if (_maxSpeed > 0.0)
+    {
+        const L speedSq = (_v[0] * _v[0]) + (_v[1] * _v[1]) + (_v[2] * _v[2]);
+        const L maxSpeed = simdSplat<L>(_maxSpeed);
+        const L scale = simdSelect(simdGreater(speedSq, maxSpeed * maxSpeed), maxSpeed / simdSqrt(speedSq), simdSplat<L>(1.0));
+        for (uint32 k = 0; k < 3; k++)
+        {
+            _v[k] = _v[k] * scale;
+        }
+    }
+}
+
+// v += a * dt, then x += v * dt
+template<typename T>
+void integrateEuler(const integrateState_t<T> &_state, const integrateParams_t<T> &_params, const T _dt)
+{
+    const T decay = std::exp(-_params.damping * _dt);
+    parallelForLanes<T>(_state.count, LIB_MATH_INTEGRATE_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        const L dt = simdSplat<L>(_dt);
+        L a[3];
+        L v[3];
+        integrateAcceleration<L>(_state, _params, _i, a);
+        for (uint32 k = 0; k < 3; k++)
+        {
+            v[k] = simdMadd(a[k], dt, simdLoadAt<L>(_state.velocity[k], _i));
+        }
+        integrateLimit<L>(v, decay, _params.maxSpeed);
+        for (uint32 k = 0; k < 3; k++)
+        {
+            simdStoreAt<L>(_state.velocity[k], _i, v[k]);
+            simdStoreAt<L>(_state.position[k], _i, simdMadd(v[k], dt, simdLoadAt<L>(_state.position[k], _i)));
+        }
+    });
+}
+
+// velocity Verlet in kick-drift-kick form: integrateVerletPosition() with the current forces,
+// update the forces for the new positions, then integrateVerletVelocity()
+template<typename T>
+void integrateVerletPosition(const integrateState_t<T> &_state, const integrateParams_t<T> &_params, const T _dt)
+{
+    parallelForLanes<T>(_state.count, LIB_MATH_INTEGRATE_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        const L dt = simdSplat<L>(_dt);
+        const L halfDt = simdSplat<L>(0.5 * _dt);
+        L a[3];
+        integrateAcceleration<L>(_state, _params, _i, a);
+        for (uint32 k = 0; k < 3; k++)
+        {
+            const L v = simdMadd(a[k], halfDt, simdLoadAt<L>(_state.velocity[k], _i));
+            simdStoreAt<L>(_state.velocity[k], _i, v);
+            simdStoreAt<L>(_state.position[k], _i, simdMadd(v, dt, simdLoadAt<L>(_state.position[k], _i)));
+        }
+    });
+}
+
+template<typename T>
+void integrateVerletVelocity(const integrateState_t<T> &_state, const integrateParams_t<T> &_params, const T _dt)
+{
+    const T decay = std::exp(-_params.damping * _dt);
+    parallelForLanes<T>(_state.count, LIB_MATH_INTEGRATE_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        const L halfDt = simdSplat<L>(0.5 * _dt);
+        L a[3];
+        L v[3];
+        integrateAcceleration<L>(_state, _params, _i, a);
+        for (uint32 k = 0; k < 3; k++)
+        {
+            v[k] = simdMadd(a[k], halfDt, simdLoadAt<L>(_state.velocity[k], _i));
+        }
+        integrateLimit<L>(v, decay, _params.maxSpeed);
+        for (uint32 k = 0; k < 3; k++)
+        {
+            simdStoreAt<L>(_state.velocity[k], _i, v[k]);
+        }
+    });
+}
+
+// classic RK4, _accel(x, v, a, index) adds position / velocity dependent acceleration (springs,
+// drag ...) for a lane group, write it as a generic lambda since L is float32x8 or T:
+// [](const auto *_x, const auto *_v, auto *_a, const size_t _i) { ... }
+template<typename T, typename F>
+void integrateRK4(const integrateState_t<T> &_state, const integrateParams_t<T> &_params, const T _dt, F &&_accel)
+{
+    const T decay = std::exp(-_params.damping * _dt);
+    parallelForLanes<T>(_state.count, LIB_MATH_INTEGRATE_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        const L step[4] = { simdSplat<L>(0.0), simdSplat<L>(0.5 * _dt), simdSplat<L>(0.5 * _dt), simdSplat<L>(_dt) };
+        const L weight[4] = { simdSplat<L>(_dt / 6.0), simdSplat<L>(_dt / 3.0), simdSplat<L>(_dt / 3.0), simdSplat<L>(_dt / 6.0) };
+        L base[3];
+        L x0[3];
+        L v0[3];
+        L x[3];
+        L v[3];
+        L dx[3];
+        L dv[3];
+        L sumX[3];
+        L sumV[3];
+        integrateAcceleration<L>(_state, _params, _i, base);
+        for (uint32 k = 0; k < 3; k++)
+        {
+            x0[k]   = simdLoadAt<L>(_state.position[k], _i);
+            v0[k]   = simdLoadAt<L>(_state.velocity[k], _i);
+            dx[k]   = simdSplat<L>(0.0);
+            dv[k]   = simdSplat<L>(0.0);
+            sumX[k] = x0[k];
+            sumV[k] = v0[k];
+        }
+        for (uint32 s = 0; s < 4; s++)
+        {
+            L a[3];
+            for (uint32 k = 0; k < 3; k++)
+            {
+                x[k] = simdMadd(dx[k], step[s], x0[k]);
+                v[k] = simdMadd(dv[k], step[s], v0[k]);
+                a[k] = base[k];
+            }
+            _accel(static_cast<const L *>(x), static_cast<const L *>(v), static_cast<L *>(a), _i);
+            for (uint32 k = 0; k < 3; k++)
+            {
+                dx[k]   = v[k];
+                dv[k]   = a[k];
+                sumX[k] = simdMadd(dx[k], weight[s], sumX[k]);
+                sumV[k] = simdMadd(dv[k], weight[s], sumV[k]);
+            }
+        }
+        integrateLimit<L>(sumV, decay, _params.maxSpeed);
+        for (uint32 k = 0; k < 3; k++)
+        {
+            simdStoreAt<L>(_state.position[k], _i, sumX[k]);
+            simdStoreAt<L>(_state.velocity[k], _i, sumV[k]);
+        }
+    });
+}
+
+// q += 0.5 * dt * (0, w) * q, renormalized, after damping / clamping the angular velocity
+template<typename T>
+void integrateOrientation(const integrateState_t<T> &_state, const integrateParams_t<T> &_params, const T _dt)
+{
+    const T decay = std::exp(-_params.angularDamping * _dt);
+    parallelForLanes<T>(_state.count, LIB_MATH_INTEGRATE_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        const L h = simdSplat<L>(0.5 * _dt);
+        L w[3];
+        L q[4];
+        for (uint32 k = 0; k < 3; k++)
+        {
+            w[k] = simdLoadAt<L>(_state.angularVelocity[k], _i);
+        }
+        for (uint32 k = 0; k < 4; k++)
+        {
+            q[k] = simdLoadAt<L>(_state.orientation[k], _i);
+        }
+        integrateLimit<L>(w, decay, _params.maxAngularSpeed);
+        const L s = q[0] - (h * ((w[0] * q[1]) + (w[1] * q[2]) + (w[2] * q[3])));
+        const L x = q[1] + (h * ((q[0] * w[0]) + (w[1] * q[3]) - (w[2] * q[2])));
+        const L y = q[2] + (h * ((q[0] * w[1]) + (w[2] * q[1]) - (w[0] * q[3])));
+        const L z = q[3] + (h * ((q[0] * w[2]) + (w[0] * q[2]) - (w[1] * q[1])));
+        const L norm = simdSplat<L>(1.0) / simdSqrt((s * s) + (x * x) + (y * y) + (z * z));
+        simdStoreAt<L>(_state.orientation[0], _i, s * norm);
+        simdStoreAt<L>(_state.orientation[1], _i, x * norm);
+        simdStoreAt<L>(_state.orientation[2], _i, y * norm);
+        simdStoreAt<L>(_state.orientation[3], _i, z * norm);
+        for (uint32 k = 0; k < 3; k++)
+        {
+            simdStoreAt<L>(_state.angularVelocity[k], _i, w[k]);
+        }
+    });
+}
+
+#endif // LIB_MATH_INTEGRATE_HPP
@@ -0,0 +1,361 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_KDTREE_HPP
+#define LIB_MATH_KDTREE_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#define LIB_MATH_KDTREE_LEAF  8    // ranges up to this size are scanned linearly
+#define LIB_MATH_KDTREE_GRAIN 1024 // minimum queries per thread
+
+// Implicit k-d tree: the points are reordered so that every node is a range [begin, end) whose
+// median (begin + end) / 2 is the splitting point, no child pointers are stored. Each node splits
+// its widest bounding box axis. Queries compare squared distances only.
+// Results are indices into the point array passed to build().
+template<typename T>
+struct kdtree_t
+{
+    std::vector<vec3_t<T>> points; // tree order
+    std::vector<uint32> indices;   // original index of points[i]
+    std::vector<uint8> axis;       // split axis of the node with median i
+
+    void build(const vec3_t<T> *_points, const size_t _count)
+    {
+        struct item { vec3_t<T> p; uint32 i; };
+        std::vector<item> items(_count);
+        parallelFor(_count, 65536, [&](const size_t _begin, const size_t _end)
+        {
+            for (size_t i = _begin; i < _end; i++)
+            {
+                items[i].p = _points[i];
+                items[i].i = static_cast<uint32>(i);
+            }
+        });
+        axis.assign(_count, 0);
+        auto bounds = [&](const size_t _begin, const size_t _end, vec3_t<T> &_lo, vec3_t<T> &_hi)
+        {
+            for (size_t i = _begin; i < _end; i++)
+            {
+                for (uint32 k = 0; k < 3; k++)
+                {
+                    _lo[k] = std::min(_lo[k], items[i].p[k]);
+                    _hi[k] = std::max(_hi[k], items[i].p[k]);
+                }
+            }
+        };
+        auto partition = [&](const size_t _begin, const size_t _end, const vec3_t<T> &_lo, const vec3_t<T> &_hi) -> size_t
+        {
+            const vec3_t<T> extent = _hi - _lo;
+            const uint8 a = (extent.x >= extent.y) ? ((extent.x >= extent.z) ? 0 : 2) : ((extent.y >= extent.z) ? 1 : 2);
+            const size_t mid = (_begin + _end) / 2;
+            std::nth_element(items.begin() + _begin, items.begin() + mid, items.begin() + _end, [a](const item &_l, const item &_r) { return _l.p[a] < _r.p[a]; });
+            axis[mid] = a;
+            return mid;
+        };
+        auto split = [&](const size_t _begin, const size_t _end) -> size_t
+        {
+            vec3_t<T> lo(std::numeric_limits<T>::max());
+            vec3_t<T> hi(std::numeric_limits<T>::lowest());
+            bounds(_begin, _end, lo, hi);
+            return partition(_begin, _end, lo, hi);
+        };
+        // the top levels are split a level at a time until there are enough subtrees for every
+        // thread, the ranges of a level are split in parallel and while there are fewer ranges than
+        // threads their bounding boxes are reduced over several pieces per range
+        const size_t threads = static_cast<size_t>(parallelThreadCount());
+        std::vector<std::pair<size_t, size_t>> ranges(1, std::make_pair(static_cast<size_t>(0), _count));
+        std::vector<std::pair<size_t, size_t>> next;
+        std::vector<vec3_t<T>> lo;
+        std::vector<vec3_t<T>> hi;
+        std::vector<size_t> mids;
+        bool splittable = true;
+        while ((ranges.size() < (threads * 4)) && splittable)
+        {
+            const size_t pieces = std::max<size_t>(1, threads / ranges.size());
+            lo.assign(ranges.size() * pieces, vec3_t<T>(std::numeric_limits<T>::max()));
+            hi.assign(ranges.size() * pieces, vec3_t<T>(std::numeric_limits<T>::lowest()));
+            parallelFor(ranges.size() * pieces, 1, [&](const size_t _begin, const size_t _end)
+            {
+                for (size_t t = _begin; t < _end; t++)
+                {
+                    const std::pair<size_t, size_t> &r = ranges[t / pieces];
+                    const size_t size = r.second - r.first;
+                    const size_t p    = t % pieces;
+                    bounds(r.first + ((size * p) / pieces), r.first + ((size * (p + 1)) / pieces), lo[t], hi[t]);
+                }
+            });
+            mids.assign(ranges.size(), 0);
+            parallelFor(ranges.size(), 1, [&](const size_t _begin, const size_t _end)
+            {
+                for (size_t r = _begin; r < _end; r++)
+                {
+                    if ((ranges[r].second - ranges[r].first) > LIB_MATH_KDTREE_LEAF)
+                    {
+                        for (size_t p = 1; p < pieces; p++)
+                        {
+                            for (uint32 k = 0; k < 3; k++)
+                            {
+                                lo[r * pieces][k] = std::min(lo[r * pieces][k], lo[(r * pieces) + p][k]);
+                                hi[r * pieces][k] = std::max(hi[r * pieces][k], hi[(r * pieces) + p][k]);
+                            }
+                        }
+                        mids[r] = partition(ranges[r].first, ranges[r].second, lo[r * pieces], hi[r * pieces]);
+                    }
+                }
+            });
+            splittable = false;
+            next.clear();
+            for (size_t r = 0; r < ranges.size(); r++)
+            {
+                if ((ranges[r].second - ranges[r].first) <= LIB_MATH_KDTREE_LEAF)
+                {
+                    next.push_back(ranges[r]);
+                    continue;
+                }
+                next.push_back(std::make_pair(ranges[r].first, mids[r]));
+                next.push_back(std::make_pair(mids[r] + 1, ranges[r].second));
+                splittable = true;
+            }
+            ranges.swap(next);
+        }
+        parallelFor(ranges.size(), 1, [&](const size_t _begin, const size_t _end)
+        {
+            std::vector<std::pair<size_t, size_t>> stack;
+            for (size_t r = _begin; r < _end; r++)
+            {
+                stack.push_back(ranges[r]);
+                while (!stack.empty())
+                {
+                    const std::pair<size_t, size_t> range = stack.back();
+                    stack.pop_back();
+                    if ((range.second - range.first) > LIB_MATH_KDTREE_LEAF)
+                    {
+                        const size_t mid = split(range.first, range.second);
+                        stack.push_back(std::make_pair(range.first, mid));
+                        stack.push_back(std::make_pair(mid + 1, range.second));
+                    }
+                }
+            }
+        });
+        points.resize(_count);
+        indices.resize(_count);
+        parallelFor(_count, 65536, [&](const size_t _begin, const size_t _end)
+        {
+            for (size_t i = _begin; i < _end; i++)
+            {
+                points[i]  = items[i].p;
+                indices[i] = items[i].i;
+            }
+        });
+    }
+
+    // up to _k nearest neighbours sorted by distance, _heap is scratch space of _k entries,
+    // returns the number found (less than _k for small trees or a bounded _maxDistSq)
+    uint32 knn(const vec3_t<T> &_q, const uint32 _k, uint32 *_indices, T *_distSq, std::pair<T, uint32> *_heap, const T _maxDistSq = std::numeric_limits<T>::max()) const
+    {
+        if ((_k == 0) || points.empty())
+        {
+            return 0;
+        }
+        uint32 size = 0;
+        knnRange(0, points.size(), _q, _k, _heap, size, _maxDistSq);
+        std::sort_heap(_heap, _heap + size);
+        for (uint32 i = 0; i < size; i++)
+        {
+            _distSq[i]  = _heap[i].first;
+            _indices[i] = indices[_heap[i].second];
+        }
+        return size;
+    }
+
+    uint32 knn(const vec3_t<T> &_q, const uint32 _k, uint32 *_indices, T *_distSq) const
+    {
+        std::vector<std::pair<T, uint32>> heap(_k);
+        return knn(_q, _k, _indices, _distSq, heap.data());
+    }
+
+    // returns ~0u for an empty tree
+    uint32 nearest(const vec3_t<T> &_q, T &_distSq) const
+    {
+        std::pair<T, uint32> heap[1];
+        uint32 index = ~0u;
+        _distSq = std::numeric_limits<T>::max();
+        knn(_q, 1, &index, &_distSq, heap);
+        return index;
+    }
+
+    // _func(index, distSq) for every point within _radius
+    template<typename F>
+    void radius(const vec3_t<T> &_q, const T _radius, F &&_func) const
+    {
+        if (!points.empty())
+        {
+            radiusRange(0, points.size(), _q, _radius * _radius, _func);
+        }
+    }
+
+    void radius(const vec3_t<T> &_q, const T _radius, std::vector<uint32> &_out) const
+    {
+        radius(_q, _radius, [&_out](const uint32 _index, const T) { _out.push_back(_index); });
+    }
+
+    static T distSq(const vec3_t<T> &_a, const vec3_t<T> &_b)
+    {
+        const vec3_t<T> d = _a - _b;
+        return (d.x * d.x) + (d.y * d.y) + (d.z * d.z);
+    }
+
+    void knnConsider(const size_t _i, const vec3_t<T> &_q, const uint32 _k, std::pair<T, uint32> *_heap, uint32 &_size, const T _maxDistSq) const
+    {
+        const T d = distSq(points[_i], _q);
+        if (_size < _k)
+        {
+            if (d <= _maxDistSq)
+            {
+                _heap[_size++] = std::make_pair(d, static_cast<uint32>(_i));
+                std::push_heap(_heap, _heap + _size);
+            }
+        }
+        else if (d < _heap[0].first)
+        {
+            std::pop_heap(_heap, _heap + _size);
+            _heap[_size - 1] = std::make_pair(d, static_cast<uint32>(_i));
+            std::push_heap(_heap, _heap + _size);
+        }
+    }
+
+    void knnRange(const size_t _begin, const size_t _end, const vec3_t<T> &_q, const uint32 _k, std::pair<T, uint32> *_heap, uint32 &_size, const T _maxDistSq) const
+    {
+        if ((_end - _begin) <= LIB_MATH_KDTREE_LEAF)
+        {
+            for (size_t i = _begin; i < _end; i++)
+            {
+                knnConsider(i, _q, _k, _heap, _size, _maxDistSq);
+            }
+            return;
+        }
+        const size_t mid = (_begin + _end) / 2;
+        const uint8 a = axis[mid];
+        const T diff = _q[a] - points[mid][a];
+        knnConsider(mid, _q, _k, _heap, _size, _maxDistSq);
+        if (diff < 0.0)
+        {
+            knnRange(_begin, mid, _q, _k, _heap, _size, _maxDistSq);
+        }
+        else
+        {
+            knnRange(mid + 1, _end, _q, _k, _heap, _size, _maxDistSq);
+        }
+        const T worst = (_size < _k) ? _maxDistSq : _heap[0].first;
+        if ((diff * diff) < worst)
+        {
+            if (diff < 0.0)
+            {
+                knnRange(mid + 1, _end, _q, _k, _heap, _size, _maxDistSq);
+            }
+            else
+            {
+                knnRange(_begin, mid, _q, _k, _heap, _size, _maxDistSq);
+            }
+        }
+    }
+
+    template<typename F>
+    void radiusRange(const size_t _begin, const size_t _end, const vec3_t<T> &_q, const T _radiusSq, F &_func) const
+    {
+        if ((_end - _begin) <= LIB_MATH_KDTREE_LEAF)
+        {
+            for (size_t i = _begin; i < _end; i++)
+            {
+                const T d = distSq(points[i], _q);
+                if (d <= _radiusSq)
+                {
+                    _func(indices[i], d);
+                }
+            }
+            return;
+        }
+        const size_t mid = (_begin + _end) / 2;
+        const uint8 a = axis[mid];
+        const T diff = _q[a] - points[mid][a];
+        const T d = distSq(points[mid], _q);
+        if (d <= _radiusSq)
+        {
+            _func(indices[mid], d);
+        }
+        if ((diff < 0.0) || ((diff * diff) <= _radiusSq))
+        {
+            radiusRange(_begin, mid, _q, _radiusSq, _func);
+        }
+        if ((diff >= 0.0) || ((diff * diff) <= _radiusSq))
+        {
+            radiusRange(mid + 1, _end, _q, _radiusSq, _func);
+        }
+    }
+};
+
+// _k neighbours per query written to _indices[q * _k ...] / _distSq[q * _k ...], sorted by
+// distance, missing entries are ~0u / max(), multithreaded
+template<typename T>
+void kdtreeKnnBatch(const kdtree_t<T> &_tree, const vec3_t<T> *_queries, const size_t _count, const uint32 _k, uint32 *_indices, T *_distSq)
+{
+    parallelFor(_count, LIB_MATH_KDTREE_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        std::vector<std::pair<T, uint32>> heap(_k);
+        for (size_t q = _begin; q < _end; q++)
+        {
+            uint32 *indices = _indices + (q * _k);
+            T *distSq = _distSq + (q * _k);
+            for (uint32 i = _tree.knn(_queries[q], _k, indices, distSq, heap.data()); i < _k; i++)
+            {
+                indices[i] = ~0u;
+                distSq[i]  = std::numeric_limits<T>::max();
+            }
+        }
+    });
+}
+
+// _func(query, index, distSq) for every point within _radius of each query, called concurrently
+// from the worker threads
+template<typename T, typename F>
+void kdtreeRadiusBatch(const kdtree_t<T> &_tree, const vec3_t<T> *_queries, const size_t _count, const T _radius, F &&_func)
+{
+    parallelFor(_count, LIB_MATH_KDTREE_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t q = _begin; q < _end; q++)
+        {
+            _tree.radius(_queries[q], _radius, [&](const uint32 _index, const T _d) { _func(q, _index, _d); });
+        }
+    });
+}
+
+#endif // LIB_MATH_KDTREE_HPP
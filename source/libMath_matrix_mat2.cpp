@@ -22,3 +22,13 @@
  */
 
 #include "libMath_matrix_mat2.hpp"
+
+// compile time evaluation checks
+static_assert(mat2_t<float32>(1.0f, 2.0f, 3.0f, 4.0f).determinant() == -2.0f);
+static_assert((mat2_t<float32>() * mat2_t<float32>(2.0f)).data[1][0] == 2.0f);
+static_assert((mat2_t<float32>(2.0f, 0.0f, 0.0f, 2.0f) * vec2_t<float32>(1.0f, 3.0f)).y == 6.0f);
+
+// layout checks, bulkCopy() and GPU uploads rely on these
+static_assert(std::is_trivially_copyable<mat2_t<float32>>::value && std::is_standard_layout<mat2_t<float32>>::value);
+static_assert(std::is_trivially_copyable<mat2_t<float64>>::value && std::is_standard_layout<mat2_t<float64>>::value);
+static_assert(sizeof(mat2_t<float32>) == 4 * sizeof(float32));
@@ -34,45 +34,46 @@ struct mat2_t
     //--- Column major! ---
     static const uint32_t COLUMNS = 2;
     static const uint32_t ROWS    = 2;
-    mat2_t(void) { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (i == j) ? 1.0f : 0.0f;}
-    mat2_t(int _s) { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (_s == 1) ? (i == j) ? 1.0f : 0.0f : _s; }
-    mat2_t(T _f) { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = _f; }
-    mat2_t(T _f00, T _f10,
-         T _f01, T _f11)
+    constexpr mat2_t(void) : data{} { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (i == j) ? 1.0f : 0.0f;}
+    constexpr mat2_t(int _s) : data{} { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (_s == 1) ? (i == j) ? 1.0f : 0.0f : _s; }
+    constexpr mat2_t(T _f) : data{} { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = _f; }
+    constexpr mat2_t(T _f00, T _f10,
+         T _f01, T _f11) : data{}
          {
              data[0][0] = _f00; data[0][1] = _f01;
              data[1][0] = _f10; data[1][1] = _f11;
          }
-    ~mat2_t(void) { }
-    mat2_t& operator=(const mat2_t& _m) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] = _m.array[i]; return *this; }
-    mat2_t operator+(const mat2_t& _m) const { mat2_t _tMat2; for (size_t i = 0; i < COLUMNS * ROWS; i++) _tMat2.array[i] = _m.array[i] + array[i]; return _tMat2; }
-    void operator+=(const mat2_t& _m) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] += _m.array[i]; }
-    mat2_t operator-(const mat2_t& _m) const { mat2_t _tMat2; for (size_t i = 0; i < COLUMNS * ROWS; i++) _tMat2.array[i] = _m.array[i] - array[i]; return _tMat2; }
-    void operator-=(const mat2_t& _m) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] -= _m.array[i]; }
-    mat2_t operator*(const T _s) const { mat2_t _tMat2; for (size_t i = 0; i < COLUMNS * ROWS; i++) _tMat2.array[i] = array[i] * _s; return _tMat2; }
-    void operator*=(const T _s) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] *= _s; }
-    mat2_t operator*(const mat2_t& _m) const { mat2_t _tMat2(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { for(size_t k = 0; k < COLUMNS; k++) { _tMat2.data[i][j] += data[i][k] * _m.data[k][j]; } } } return _tMat2; }
-    void operator*=(const mat2_t& _m) { mat2_t _tMat2(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { for(size_t k = 0; k < COLUMNS; k++) { _tMat2.data[i][j] += data[i][k] * _m.data[k][j]; } } } for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] = _tMat2.array[i]; }
+    constexpr mat2_t(const mat2_t& _m) = default;
+    ~mat2_t(void) = default;
+    constexpr mat2_t& operator=(const mat2_t& _m) = default;
+    constexpr mat2_t operator+(const mat2_t& _m) const { mat2_t _tMat2; for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) _tMat2.data[i][j] = data[i][j] + _m.data[i][j]; return _tMat2; }
+    constexpr void operator+=(const mat2_t& _m) { for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) data[i][j] += _m.data[i][j]; }
+    constexpr mat2_t operator-(const mat2_t& _m) const { mat2_t _tMat2; for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) _tMat2.data[i][j] = data[i][j] - _m.data[i][j]; return _tMat2; }
+    constexpr void operator-=(const mat2_t& _m) { for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) data[i][j] -= _m.data[i][j]; }
+    constexpr mat2_t operator*(const T _s) const { mat2_t _tMat2; for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) _tMat2.data[i][j] = data[i][j] * _s; return _tMat2; }
+    constexpr void operator*=(const T _s) { for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) data[i][j] *= _s; }
+    constexpr mat2_t operator*(const mat2_t& _m) const { mat2_t _tMat2(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { for(size_t k = 0; k < COLUMNS; k++) { _tMat2.data[i][j] += data[i][k] * _m.data[k][j]; } } } return _tMat2; }
+    constexpr void operator*=(const mat2_t& _m) { mat2_t _tMat2(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { for(size_t k = 0; k < COLUMNS; k++) { _tMat2.data[i][j] += data[i][k] * _m.data[k][j]; } } } *this = _tMat2; }
 
-    vec2_t<T> operator*(const vec2_t<T>& _v) const 
+    constexpr vec2_t<T> operator*(const vec2_t<T>& _v) const 
     { 
         vec2_t<T> _tVec2(0.0f); 
         for(size_t i = 0; i < ROWS; i++) 
         { 
             for(size_t j = 0; j < COLUMNS; j++)
             {
-                _tVec2.array[i] += data[i][j] * _v.array[j];
+                _tVec2[i] += data[i][j] * _v[j];
             }
         }
         return _tVec2;
     }
 
-    T determinant(void)
+    constexpr T determinant(void) const
     {
         return((data[0][0] * data[1][1]) - (data[1][0] * data[0][1]));
     }
 
-    void transpose(void)
+    constexpr void transpose(void)
     {
         for(size_t i = 0; i < ROWS; i++)
         {
@@ -88,14 +89,14 @@ struct mat2_t
         }
     }
 
-    void setCR(T _f00, T _f10,
+    constexpr void setCR(T _f00, T _f10,
                T _f01, T _f11)
                {
                    data[0][0] = _f00; data[0][1] = _f01;
                    data[1][0] = _f10; data[1][1] = _f11;
                }
     
-    void setRC(T _f00, T _f01,
+    constexpr void setRC(T _f00, T _f01,
                T _f10, T _f11)
                {
                    data[0][0] = _f00; data[0][1] = _f01;
@@ -104,8 +105,8 @@ struct mat2_t
 
     union
     {
-        struct { T array[COLUMNS * ROWS] = {0.0f}; };
-        struct { T data[COLUMNS][ROWS]; };
+        T array[COLUMNS * ROWS];
+        T data[COLUMNS][ROWS];
     };
     
 /*  -- internal test code ---
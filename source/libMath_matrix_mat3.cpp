@@ -22,3 +22,13 @@
  */
 
 #include "libMath_matrix_mat3.hpp"
+
+// compile time evaluation checks
+static_assert(mat3_t<float32>(2.0f, 0.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 0.0f, 4.0f).determinant() == 24.0f);
+static_assert((mat3_t<float32>(1) - mat3_t<float32>(1)).data[2][2] == 0.0f);
+static_assert((mat3_t<float32>(1) * vec3_t<float32>(1.0f, 2.0f, 3.0f)) == vec3_t<float32>(1.0f, 2.0f, 3.0f));
+
+// layout checks, bulkCopy() and GPU uploads rely on these
+static_assert(std::is_trivially_copyable<mat3_t<float32>>::value && std::is_standard_layout<mat3_t<float32>>::value);
+static_assert(std::is_trivially_copyable<mat3_t<float64>>::value && std::is_standard_layout<mat3_t<float64>>::value);
+static_assert(sizeof(mat3_t<float32>) == 9 * sizeof(float32));
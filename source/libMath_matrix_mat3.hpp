@@ -34,41 +34,42 @@ struct mat3_t
     //--- Column major! ---
     static const uint32_t COLUMNS = 3;
     static const uint32_t ROWS    = 3;
-    mat3_t(void) { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (i == j) ? 1.0f : 0.0f;}
-    mat3_t(int _s) { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (_s == 1) ? (i == j) ? 1.0f : 0.0f : _s; }
-    mat3_t(T _f) { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = _f; }
-    mat3_t(T _f00, T _f10, T _f20,
+    constexpr mat3_t(void) : data{} { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (i == j) ? 1.0f : 0.0f;}
+    constexpr mat3_t(int _s) : data{} { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (_s == 1) ? (i == j) ? 1.0f : 0.0f : _s; }
+    constexpr mat3_t(T _f) : data{} { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = _f; }
+    constexpr mat3_t(T _f00, T _f10, T _f20,
          T _f01, T _f11, T _f21,
-         T _f02, T _f12, T _f22)
+         T _f02, T _f12, T _f22) : data{}
          {
              data[0][0] = _f00; data[0][1] = _f01; data[0][2] = _f02;
              data[1][0] = _f10; data[1][1] = _f11; data[1][2] = _f12;
              data[2][0] = _f20; data[2][1] = _f21; data[2][2] = _f22;
          }
-    ~mat3_t(void) { }
-    mat3_t& operator=(const mat3_t& _m) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] = _m.array[i]; return *this; }
-    mat3_t operator+(const mat3_t& _m) const { mat3_t _tMat3; for (size_t i = 0; i < COLUMNS * ROWS; i++) _tMat3.array[i] = _m.array[i] + array[i]; return _tMat3; }
-    void operator+=(const mat3_t& _m) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] += _m.array[i]; }
-    mat3_t operator-(const mat3_t& _m) const { mat3_t _tMat3; for (size_t i = 0; i < COLUMNS * ROWS; i++) _tMat3.array[i] = _m.array[i] - array[i]; return _tMat3; }
-    void operator-=(const mat3_t& _m) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] -= _m.array[i]; }
-    mat3_t operator*(const T _s) const { mat3_t _tMat3; for (size_t i = 0; i < COLUMNS * ROWS; i++) _tMat3.array[i] = array[i] * _s; return _tMat3; }
-    void operator*=(const T _s) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] *= _s; }
-    mat3_t operator*(const mat3_t& _m) const { mat3_t _tMat3(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { for(size_t k = 0; k < COLUMNS; k++) { _tMat3.data[i][j] += data[i][k] * _m.data[k][j]; } } } return _tMat3; }
-    void operator*=(const mat3_t& _m) { mat3_t _tMat3(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { for(size_t k = 0; k < COLUMNS; k++) { _tMat3.data[i][j] += data[i][k] * _m.data[k][j]; } } } for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] = _tMat3.array[i]; }
-    vec3_t<T> operator*(const vec3_t<T>& _v) const 
+    constexpr mat3_t(const mat3_t& _m) = default;
+    ~mat3_t(void) = default;
+    constexpr mat3_t& operator=(const mat3_t& _m) = default;
+    constexpr mat3_t operator+(const mat3_t& _m) const { mat3_t _tMat3; for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) _tMat3.data[i][j] = data[i][j] + _m.data[i][j]; return _tMat3; }
+    constexpr void operator+=(const mat3_t& _m) { for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) data[i][j] += _m.data[i][j]; }
+    constexpr mat3_t operator-(const mat3_t& _m) const { mat3_t _tMat3; for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) _tMat3.data[i][j] = data[i][j] - _m.data[i][j]; return _tMat3; }
+    constexpr void operator-=(const mat3_t& _m) { for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) data[i][j] -= _m.data[i][j]; }
+    constexpr mat3_t operator*(const T _s) const { mat3_t _tMat3; for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) _tMat3.data[i][j] = data[i][j] * _s; return _tMat3; }
+    constexpr void operator*=(const T _s) { for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) data[i][j] *= _s; }
+    constexpr mat3_t operator*(const mat3_t& _m) const { mat3_t _tMat3(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { for(size_t k = 0; k < COLUMNS; k++) { _tMat3.data[i][j] += data[i][k] * _m.data[k][j]; } } } return _tMat3; }
+    constexpr void operator*=(const mat3_t& _m) { mat3_t _tMat3(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { for(size_t k = 0; k < COLUMNS; k++) { _tMat3.data[i][j] += data[i][k] * _m.data[k][j]; } } } *this = _tMat3; }
+    constexpr vec3_t<T> operator*(const vec3_t<T>& _v) const 
     { 
         vec3_t<T> _tVec3(0.0f); 
         for(size_t i = 0; i < ROWS; i++) 
         { 
             for(size_t j = 0; j < COLUMNS; j++)
             {
-                _tVec3.array[i] += data[i][j] * _v.array[j];
+                _tVec3[i] += data[i][j] * _v[j];
             }
         }
         return _tVec3;
     }
 
-    T determinant(void)
+    constexpr T determinant(void) const
     {
         T det = 0;
         det += data[0][0] * ((data[1][1] * data[2][2]) - (data[1][2] * data[2][1]));
@@ -77,7 +78,7 @@ struct mat3_t
         return det;
     }
 
-    void transpose(void)
+    constexpr void transpose(void)
     {
         for(size_t i = 0; i < ROWS; i++)
         {
@@ -93,7 +94,7 @@ struct mat3_t
         }
     }
 
-    void setCR(T _f00, T _f10, T _f20,
+    constexpr void setCR(T _f00, T _f10, T _f20,
                T _f01, T _f11, T _f21,
                T _f02, T _f12, T _f22)
                {
@@ -102,7 +103,7 @@ struct mat3_t
                    data[2][0] = _f20; data[2][1] = _f21; data[2][2] = _f22;
                }
     
-    void setRC(T _f00, T _f01, T _f02,
+    constexpr void setRC(T _f00, T _f01, T _f02,
                T _f10, T _f11, T _f12,
                T _f20, T _f21, T _f22)
                {
@@ -113,8 +114,8 @@ struct mat3_t
 
     union
     {
-        struct { T array[COLUMNS * ROWS] = {0.0f}; };
-        struct { T data[COLUMNS][ROWS]; };
+        T array[COLUMNS * ROWS];
+        T data[COLUMNS][ROWS];
     };
 
 /*  -- internal test code ---
@@ -22,3 +22,13 @@
  */
 
 #include "libMath_matrix_mat4.hpp"
+
+// compile time evaluation checks
+static_assert(mat4_t<float32>().determinant() == 1.0f);
+static_assert(mat4_t<float32>(2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f).inverse().data[1][1] == 0.5f);
+static_assert([]() { mat4_t<float32> m(1); m.data[0][3] = 5.0f; m.transpose(); return m.data[3][0]; }() == 5.0f);
+
+// layout checks, bulkCopy() and GPU uploads rely on these
+static_assert(std::is_trivially_copyable<mat4_t<float32>>::value && std::is_standard_layout<mat4_t<float32>>::value);
+static_assert(std::is_trivially_copyable<mat4_t<float64>>::value && std::is_standard_layout<mat4_t<float64>>::value);
+static_assert(sizeof(mat4_t<float32>) == 16 * sizeof(float32));
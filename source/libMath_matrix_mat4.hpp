@@ -26,6 +26,7 @@
 
 #include "libMath_defines.hpp"
 #include "libMath_includes.hpp"
+#include "libMath_instrument.hpp"
 #include "libMath_matrix_mat3.hpp"
 #include "libMath_vector.hpp"
 
@@ -40,37 +41,39 @@ struct mat4_t
     static const uint32_t SIZE    = COLUMNS * ROWS;
     
     // constructors and destructor
-    mat4_t(void) { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (i == j) ? 1.0f : 0.0f;}
-    mat4_t(int _s) { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (_s == 1) ? (i == j) ? 1.0f : 0.0f : _s; }
-    mat4_t(T _f) { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = _f; }
-    mat4_t(T _f00, T _f10, T _f20, T _f30,
+    constexpr mat4_t(void) : data{} { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (i == j) ? 1.0f : 0.0f;}
+    constexpr mat4_t(int _s) : data{} { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = (_s == 1) ? (i == j) ? 1.0f : 0.0f : _s; }
+    constexpr mat4_t(T _f) : data{} { for (size_t i = 0; i < ROWS; i++) for (size_t j = 0; j < COLUMNS; j++) data[j][i] = _f; }
+    constexpr mat4_t(T _f00, T _f10, T _f20, T _f30,
          T _f01, T _f11, T _f21, T _f31,
          T _f02, T _f12, T _f22, T _f32,
-         T _f03, T _f13, T _f23, T _f33)
+         T _f03, T _f13, T _f23, T _f33) : data{}
          {
              data[0][0] = _f00; data[0][1] = _f01; data[0][2] = _f02; data[0][3] = _f03;
              data[1][0] = _f10; data[1][1] = _f11; data[1][2] = _f12; data[1][3] = _f13;
              data[2][0] = _f20; data[2][1] = _f21; data[2][2] = _f22; data[2][3] = _f23;
              data[3][0] = _f30; data[3][1] = _f31; data[3][2] = _f32; data[3][3] = _f33;
          }
-    ~mat4_t(void) { }
+    constexpr mat4_t(const mat4_t& _m) = default;
+    ~mat4_t(void) = default;
     
     // operators
-    mat4_t& operator=(const mat4_t& _m) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] = _m.array[i]; return *this; }
-    mat4_t operator+(const mat4_t& _m) const { mat4_t _tMat4; for (size_t i = 0; i < COLUMNS * ROWS; i++) _tMat4.array[i] = _m.array[i] + array[i]; return _tMat4; }
-    void operator+=(const mat4_t& _m) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] += _m.array[i]; }
-    mat4_t operator-(const mat4_t& _m) const { mat4_t _tMat4; for (size_t i = 0; i < COLUMNS * ROWS; i++) _tMat4.array[i] = _m.array[i] - array[i]; return _tMat4; }
-    void operator-=(const mat4_t& _m) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] -= _m.array[i]; }
-    mat4_t operator*(const T _s) const { mat4_t _tMat4; for (size_t i = 0; i < COLUMNS * ROWS; i++) _tMat4.array[i] = array[i] * _s; return _tMat4; }
-    void operator*=(const T _s) { for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] *= _s; }
-    mat4_t operator*(const mat4_t& _m) const { mat4_t _tMat4(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { for(size_t k = 0; k < COLUMNS; k++) { _tMat4.data[i][j] += (data[i][k] * _m.data[k][j]); } } } return _tMat4; }
-    void operator*=(const mat4_t& _m) { mat4_t _tMat4(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { for(size_t k = 0; k < COLUMNS; k++) { _tMat4.data[i][j] += data[i][k] * _m.data[k][j]; } } } for (size_t i = 0; i < COLUMNS * ROWS; i++) array[i] = _tMat4.array[i]; }
-    vec4_t<T> operator*(const vec4_t<T>& _v) const { vec4_t<T> _tVec4(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { _tVec4.array[i] += data[i][j] * _v.array[j]; } } return _tVec4; }
+    constexpr mat4_t& operator=(const mat4_t& _m) = default;
+    constexpr mat4_t operator+(const mat4_t& _m) const { mat4_t _tMat4; for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) _tMat4.data[i][j] = data[i][j] + _m.data[i][j]; return _tMat4; }
+    constexpr void operator+=(const mat4_t& _m) { for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) data[i][j] += _m.data[i][j]; }
+    constexpr mat4_t operator-(const mat4_t& _m) const { mat4_t _tMat4; for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) _tMat4.data[i][j] = data[i][j] - _m.data[i][j]; return _tMat4; }
+    constexpr void operator-=(const mat4_t& _m) { for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) data[i][j] -= _m.data[i][j]; }
+    constexpr mat4_t operator*(const T _s) const { mat4_t _tMat4; for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) _tMat4.data[i][j] = data[i][j] * _s; return _tMat4; }
+    constexpr void operator*=(const T _s) { for (size_t i = 0; i < COLUMNS; i++) for (size_t j = 0; j < ROWS; j++) data[i][j] *= _s; }
+    constexpr mat4_t operator*(const mat4_t& _m) const { LIB_MATH_INSTRUMENT_SCOPE(INSTRUMENT_MAT4_MULTIPLY, 1); mat4_t _tMat4(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { for(size_t k = 0; k < COLUMNS; k++) { _tMat4.data[i][j] += (data[i][k] * _m.data[k][j]); } } } return _tMat4; }
+    constexpr void operator*=(const mat4_t& _m) { *this = *this * _m; }
+    constexpr vec4_t<T> operator*(const vec4_t<T>& _v) const { LIB_MATH_INSTRUMENT_SCOPE(INSTRUMENT_MAT4_MULTIPLY_VEC4, 1); vec4_t<T> _tVec4(0.0f); for(size_t i = 0; i < ROWS; i++) { for(size_t j = 0; j < COLUMNS; j++) { _tVec4[i] += data[i][j] * _v[j]; } } return _tVec4; }
 
     // functions
-    uint32 size(void) { return SIZE; }
-    T determinant(void)
+    constexpr uint32 size(void) const { return SIZE; }
+    constexpr T determinant(void) const
     {
+        LIB_MATH_INSTRUMENT_SCOPE(INSTRUMENT_MAT4_DETERMINANT, 1);
         mat3_t<T>  aMat3(0.0f);
         aMat3.setRC(data[1][1], data[1][2], data[1][3],
                     data[2][1], data[2][2], data[2][3],
@@ -96,8 +99,9 @@ struct mat4_t
         return det;
     }
     
-    mat4_t inverse(void)
+    constexpr mat4_t inverse(void)
     {
+        LIB_MATH_INSTRUMENT_SCOPE(INSTRUMENT_MAT4_INVERSE, 1);
         // Determinant
         mat4_t tMat4(0.0f);
         T det = determinant();
@@ -123,7 +127,7 @@ struct mat4_t
                     {
                         if ((i != k) && (j != l))
                         {
-                            tMat3.array[count] = data[k][l];
+                            tMat3.data[count / 3][count % 3] = data[k][l];
                             count++;
                         }
                     }
@@ -138,14 +142,11 @@ struct mat4_t
         transpose();
         
         // Inverse
-        for (size_t i = 0; i < (COLUMNS * ROWS); i++)
-        {
-            tMat4.array[i] *= detInv;
-        }
+        tMat4 *= detInv;
         return(tMat4);
     }
 
-    void transpose(void)
+    constexpr void transpose(void)
     {
         for(size_t i = 0; i < ROWS; i++)
         {
@@ -161,7 +162,7 @@ struct mat4_t
         }
     }
 
-    void setCR(T _f00, T _f10, T _f20, T _f30,
+    constexpr void setCR(T _f00, T _f10, T _f20, T _f30,
                T _f01, T _f11, T _f21, T _f31,
                T _f02, T _f12, T _f22, T _f32,
                T _f03, T _f13, T _f23, T _f33)
@@ -172,7 +173,7 @@ struct mat4_t
                    data[3][0] = _f30; data[3][1] = _f31; data[3][2] = _f32; data[3][3] = _f33;
                }
     
-    void setRC(T _f00, T _f01, T _f02, T _f03,
+    constexpr void setRC(T _f00, T _f01, T _f02, T _f03,
                T _f10, T _f11, T _f12, T _f13,
                T _f20, T _f21, T _f22, T _f23,
                T _f30, T _f31, T _f32, T _f33)
@@ -185,8 +186,8 @@ struct mat4_t
 
     union
     {
-        struct { T array[COLUMNS * ROWS] = {0.0f}; };
-        struct { T data[COLUMNS][ROWS]; };
+        T array[COLUMNS * ROWS];
+        T data[COLUMNS][ROWS];
     };
     
 //  -- internal test code ---
@@ -0,0 +1,194 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_MESH_HPP
+#define LIB_MATH_MESH_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#define LIB_MATH_MESH_GRAIN 4096 // minimum triangles / vertices per thread
+
+// Per vertex normals and tangents of indexed triangle meshes. A pass over triangles writes per
+// face data, a pass over vertices gathers it through a vertex to corner adjacency built once per
+// topology. Every vertex sums its corners in ascending order from a single thread, so there are
+// no atomics and results are bitwise identical for any thread count.
+
+enum meshWeight : uint32
+{
+    MESH_WEIGHT_AREA = 0, // face normals weighted by triangle area
+    MESH_WEIGHT_ANGLE     // face normals weighted by the corner angle
+};
+
+// corners (triangle * 3 + corner) of every vertex in ascending order
+struct meshAdjacency_t
+{
+    std::vector<uint32> offsets; // vertex v owns corners[offsets[v] .. offsets[v + 1])
+    std::vector<uint32> corners;
+
+    void build(const uint32 *_indices, const size_t _triangleCount, const size_t _vertexCount)
+    {
+        offsets.assign(_vertexCount + 1, 0);
+        corners.resize(_triangleCount * 3);
+        for (size_t c = 0; c < (_triangleCount * 3); c++)
+        {
+            offsets[_indices[c] + 1]++;
+        }
+        for (size_t v = 0; v < _vertexCount; v++)
+        {
+            offsets[v + 1] += offsets[v];
+        }
+        std::vector<uint32> cursor(offsets.begin(), offsets.end() - 1);
+        for (size_t c = 0; c < (_triangleCount * 3); c++)
+        {
+            corners[cursor[_indices[c]]++] = static_cast<uint32>(c);
+        }
+    }
+};
+
+// functions
+
+template<typename T>
+inline T meshCornerAngle(const vec3_t<T> &_a, const vec3_t<T> &_b)
+{
+    const T la = _a.length();
+    const T lb = _b.length();
+    if ((la <= 0.0) || (lb <= 0.0))
+    {
+        return 0.0;
+    }
+    return std::acos(std::clamp(_a.dot(_b) / (la * lb), static_cast<T>(-1.0), static_cast<T>(1.0)));
+}
+
+// unit normals, vertices without (non degenerate) triangles get (0, 0, 0)
+template<typename T>
+void meshNormals(const vec3_t<T> *_positions, const uint32 *_indices, const size_t _triangleCount, const meshAdjacency_t &_adjacency, const meshWeight _weight, vec3_t<T> *_normals)
+{
+    // weighted face normal per corner
+    std::vector<vec3_t<T>> corner(_triangleCount * 3);
+    parallelFor(_triangleCount, LIB_MATH_MESH_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t t = _begin; t < _end; t++)
+        {
+            const vec3_t<T> &p0 = _positions[_indices[(t * 3) + 0]];
+            const vec3_t<T> &p1 = _positions[_indices[(t * 3) + 1]];
+            const vec3_t<T> &p2 = _positions[_indices[(t * 3) + 2]];
+            const vec3_t<T> n = (p1 - p0).cross(p2 - p0);
+            if (_weight == MESH_WEIGHT_AREA)
+            {
+                corner[(t * 3) + 0] = n;
+                corner[(t * 3) + 1] = n;
+                corner[(t * 3) + 2] = n;
+            }
+            else
+            {
+                const vec3_t<T> u = n.normalized();
+                corner[(t * 3) + 0] = u * meshCornerAngle(p1 - p0, p2 - p0);
+                corner[(t * 3) + 1] = u * meshCornerAngle(p2 - p1, p0 - p1);
+                corner[(t * 3) + 2] = u * meshCornerAngle(p0 - p2, p1 - p2);
+            }
+        }
+    });
+    parallelFor(_adjacency.offsets.size() - 1, LIB_MATH_MESH_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t v = _begin; v < _end; v++)
+        {
+            vec3_t<T> n(0.0);
+            for (uint32 i = _adjacency.offsets[v]; i < _adjacency.offsets[v + 1]; i++)
+            {
+                n += corner[_adjacency.corners[i]];
+            }
+            _normals[v] = n.normalized();
+        }
+    });
+}
+
+// MikkTSpace tangents: per face UV derivative tangent / bitangent, projected into the plane of the
+// vertex normal, normalized and summed weighted by the projected corner angle, w = +-1 is the
+// bitangent sign (bitangent = w * cross(normal, tangent)). Matches MikkTSpace where UV seams and
+// mirrored UV islands are already split into separate vertices, as MikkTSpace splits them itself.
+// Vertices without usable UVs get an arbitrary unit tangent perpendicular to the normal.
+template<typename T>
+void meshTangents(const vec3_t<T> *_positions, const vec3_t<T> *_normals, const vec2_t<T> *_uvs, const uint32 *_indices, const size_t _triangleCount, const meshAdjacency_t &_adjacency, vec4_t<T> *_tangents)
+{
+    std::vector<vec3_t<T>> faceS(_triangleCount);
+    std::vector<vec3_t<T>> faceT(_triangleCount);
+    parallelFor(_triangleCount, LIB_MATH_MESH_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t t = _begin; t < _end; t++)
+        {
+            const uint32 i0 = _indices[(t * 3) + 0];
+            const uint32 i1 = _indices[(t * 3) + 1];
+            const uint32 i2 = _indices[(t * 3) + 2];
+            const vec3_t<T> d1 = _positions[i1] - _positions[i0];
+            const vec3_t<T> d2 = _positions[i2] - _positions[i0];
+            const vec2_t<T> t21 = _uvs[i1] - _uvs[i0];
+            const vec2_t<T> t31 = _uvs[i2] - _uvs[i0];
+            // directions of dP/du and dP/dv, faces without UV area contribute nothing
+            const T area = (t21.x * t31.y) - (t21.y * t31.x);
+            const T sign = (area < 0.0) ? static_cast<T>(-1.0) : (area > 0.0) ? static_cast<T>(1.0) : static_cast<T>(0.0);
+            faceS[t] = ((d1 * t31.y) - (d2 * t21.y)).normalized() * sign;
+            faceT[t] = ((d2 * t21.x) - (d1 * t31.x)).normalized() * sign;
+        }
+    });
+    parallelFor(_adjacency.offsets.size() - 1, LIB_MATH_MESH_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t v = _begin; v < _end; v++)
+        {
+            const vec3_t<T> n = _normals[v];
+            vec3_t<T> s(0.0);
+            vec3_t<T> b(0.0);
+            for (uint32 i = _adjacency.offsets[v]; i < _adjacency.offsets[v + 1]; i++)
+            {
+                const uint32 c = _adjacency.corners[i];
+                const uint32 t = c / 3;
+                const uint32 k = c % 3;
+                const vec3_t<T> p = _positions[v];
+                vec3_t<T> e1 = _positions[_indices[(t * 3) + ((k + 1) % 3)]] - p;
+                vec3_t<T> e2 = _positions[_indices[(t * 3) + ((k + 2) % 3)]] - p;
+                e1 -= n * n.dot(e1);
+                e2 -= n * n.dot(e2);
+                const T angle = meshCornerAngle(e1, e2);
+                s += (faceS[t] - (n * n.dot(faceS[t]))).normalized() * angle;
+                b += (faceT[t] - (n * n.dot(faceT[t]))).normalized() * angle;
+            }
+            if (s.dot(s) <= 0.0)
+            {
+                // Duff et al. orthonormal basis
+                const T sign = std::copysign(static_cast<T>(1.0), n.z);
+                const T a = static_cast<T>(-1.0) / (sign + n.z);
+                s = vec3_t<T>(static_cast<T>(1.0) + (sign * n.x * n.x * a), sign * n.x * n.y * a, -sign * n.x);
+            }
+            s.normalize();
+            _tangents[v] = vec4_t<T>(s.x, s.y, s.z, (n.cross(s).dot(b) < 0.0) ? static_cast<T>(-1.0) : static_cast<T>(1.0));
+        }
+    });
+}
+
+#endif // LIB_MATH_MESH_HPP
@@ -0,0 +1,279 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_MORTON_HPP
+#define LIB_MATH_MORTON_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_simd.hpp"
+#include "libMath_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#define LIB_MATH_MORTON_GRAIN 16384 // minimum points per thread
+
+// Morton (Z-order) and Hilbert keys for 3D points: 10 bits per axis in a uint32 (30-bit key) or
+// 21 bits per axis in a uint64 (63-bit key). Points are quantized to the cells of a bounding box,
+// points outside the box are clamped to its border cells. Bit interleaving uses BMI2 pdep / pext
+// when compiled with -mbmi2 (or -march=native on Haswell and later), magic-number shifts otherwise.
+// x takes the lowest bit of every triple for Morton keys, Hilbert keys follow Skilling's transpose.
+
+// functions
+
+inline uint32 mortonExpand(const uint32 _v)
+{
+#if defined(LIB_MATH_BMI2)
+    return _pdep_u32(_v, 0x09249249u);
+#else
+    uint32 v = _v & 0x000003ffu;
+    v = (v | (v << 16)) & 0x030000ffu;
+    v = (v | (v << 8))  & 0x0300f00fu;
+    v = (v | (v << 4))  & 0x030c30c3u;
+    v = (v | (v << 2))  & 0x09249249u;
+    return v;
+#endif
+}
+
+inline uint64 mortonExpand(const uint64 _v)
+{
+#if defined(LIB_MATH_BMI2)
+    return _pdep_u64(_v, 0x1249249249249249ull);
+#else
+    uint64 v = _v & 0x00000000001fffffull;
+    v = (v | (v << 32)) & 0x001f00000000ffffull;
+    v = (v | (v << 16)) & 0x001f0000ff0000ffull;
+    v = (v | (v << 8))  & 0x100f00f00f00f00full;
+    v = (v | (v << 4))  & 0x10c30c30c30c30c3ull;
+    v = (v | (v << 2))  & 0x1249249249249249ull;
+    return v;
+#endif
+}
+
+inline uint32 mortonCompact(const uint32 _v)
+{
+#if defined(LIB_MATH_BMI2)
+    return _pext_u32(_v, 0x09249249u);
+#else
+    uint32 v = _v & 0x09249249u;
+    v = (v | (v >> 2))  & 0x030c30c3u;
+    v = (v | (v >> 4))  & 0x0300f00fu;
+    v = (v | (v >> 8))  & 0x030000ffu;
+    v = (v | (v >> 16)) & 0x000003ffu;
+    return v;
+#endif
+}
+
+inline uint64 mortonCompact(const uint64 _v)
+{
+#if defined(LIB_MATH_BMI2)
+    return _pext_u64(_v, 0x1249249249249249ull);
+#else
+    uint64 v = _v & 0x1249249249249249ull;
+    v = (v | (v >> 2))  & 0x10c30c30c30c30c3ull;
+    v = (v | (v >> 4))  & 0x100f00f00f00f00full;
+    v = (v | (v >> 8))  & 0x001f0000ff0000ffull;
+    v = (v | (v >> 16)) & 0x001f00000000ffffull;
+    v = (v | (v >> 32)) & 0x00000000001fffffull;
+    return v;
+#endif
+}
+
+// K = uint32 for 10 bit coordinates, uint64 for 21 bit coordinates
+template<typename K>
+constexpr uint32 mortonBits(void)
+{
+    return (sizeof(K) == 8) ? 21 : 10;
+}
+
+template<typename K>
+inline K mortonEncode(const K _x, const K _y, const K _z)
+{
+    return mortonExpand(_x) | (mortonExpand(_y) << 1) | (mortonExpand(_z) << 2);
+}
+
+template<typename K>
+inline void mortonDecode(const K _key, K &_x, K &_y, K &_z)
+{
+    _x = mortonCompact(_key);
+    _y = mortonCompact(static_cast<K>(_key >> 1));
+    _z = mortonCompact(static_cast<K>(_key >> 2));
+}
+
+template<typename K>
+inline K hilbertEncode(const K _x, const K _y, const K _z)
+{
+    constexpr K top = static_cast<K>(1) << (mortonBits<K>() - 1);
+    K x[3] = { _x, _y, _z };
+    for (K q = top; q > 1; q >>= 1)
+    {
+        const K p = q - 1;
+        for (uint32 i = 0; i < 3; i++)
+        {
+            if (x[i] & q)
+            {
+                x[0] ^= p;
+            }
+            else
+            {
+                const K t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+    x[1] ^= x[0];
+    x[2] ^= x[1];
+    K t = 0;
+    for (K q = top; q > 1; q >>= 1)
+    {
+        if (x[2] & q)
+        {
+            t ^= q - 1;
+        }
+    }
+    return mortonEncode<K>(x[2] ^ t, x[1] ^ t, x[0] ^ t);
+}
+
+template<typename K>
+inline void hilbertDecode(const K _key, K &_x, K &_y, K &_z)
+{
+    K x[3];
+    mortonDecode<K>(_key, x[2], x[1], x[0]);
+    const K gray = x[2] >> 1;
+    x[2] ^= x[1];
+    x[1] ^= x[0];
+    x[0] ^= gray;
+    constexpr K end = static_cast<K>(1) << mortonBits<K>();
+    for (K q = 2; q != end; q <<= 1)
+    {
+        const K p = q - 1;
+        for (int32 i = 2; i >= 0; i--)
+        {
+            if (x[i] & q)
+            {
+                x[0] ^= p;
+            }
+            else
+            {
+                const K t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+    _x = x[0];
+    _y = x[1];
+    _z = x[2];
+}
+
+// grid cell of _p in the box [_min, _max], clamped to the border cells, NaN goes to cell 0
+template<typename K, typename T>
+inline void mortonQuantize(const vec3_t<T> &_p, const vec3_t<T> &_min, const vec3_t<T> &_scale, K &_x, K &_y, K &_z)
+{
+    constexpr T top = static_cast<T>((static_cast<K>(1) << mortonBits<K>()) - 1);
+    auto cell = [](const T _v) -> K { return static_cast<K>((_v > 0.0) ? ((_v < top) ? _v : top) : static_cast<T>(0.0)); };
+    _x = cell((_p.x - _min.x) * _scale.x);
+    _y = cell((_p.y - _min.y) * _scale.y);
+    _z = cell((_p.z - _min.z) * _scale.z);
+}
+
+template<typename K, typename T>
+inline vec3_t<T> mortonScale(const vec3_t<T> &_min, const vec3_t<T> &_max)
+{
+    constexpr T cells = static_cast<T>(static_cast<K>(1) << mortonBits<K>());
+    const vec3_t<T> extent = _max - _min;
+    return vec3_t<T>((extent.x > 0.0) ? (cells / extent.x) : static_cast<T>(0.0),
+                     (extent.y > 0.0) ? (cells / extent.y) : static_cast<T>(0.0),
+                     (extent.z > 0.0) ? (cells / extent.z) : static_cast<T>(0.0));
+}
+
+// bounding box of a point span, multithreaded
+template<typename T>
+void mortonBounds(const vec3_t<T> *_points, const size_t _count, vec3_t<T> &_min, vec3_t<T> &_max)
+{
+    const size_t chunks = std::max<size_t>(1, std::min<size_t>(parallelThreadCount(), _count / LIB_MATH_MORTON_GRAIN));
+    std::vector<vec3_t<T>> lo(chunks, vec3_t<T>(std::numeric_limits<T>::max()));
+    std::vector<vec3_t<T>> hi(chunks, vec3_t<T>(std::numeric_limits<T>::lowest()));
+    parallelFor(chunks, 1, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t c = _begin; c < _end; c++)
+        {
+            const size_t end = (_count * (c + 1)) / chunks;
+            for (size_t i = (_count * c) / chunks; i < end; i++)
+            {
+                for (uint32 k = 0; k < 3; k++)
+                {
+                    lo[c][k] = std::min(lo[c][k], _points[i][k]);
+                    hi[c][k] = std::max(hi[c][k], _points[i][k]);
+                }
+            }
+        }
+    });
+    _min = lo[0];
+    _max = hi[0];
+    for (size_t c = 1; c < chunks; c++)
+    {
+        for (uint32 k = 0; k < 3; k++)
+        {
+            _min[k] = std::min(_min[k], lo[c][k]);
+            _max[k] = std::max(_max[k], hi[c][k]);
+        }
+    }
+}
+
+// batch keys, K = uint32 for 30-bit keys, uint64 for 63-bit keys, multithreaded
+template<typename K, typename T>
+void mortonEncode(const vec3_t<T> *_points, const size_t _count, const vec3_t<T> &_min, const vec3_t<T> &_max, K *_keys)
+{
+    const vec3_t<T> scale = mortonScale<K>(_min, _max);
+    parallelFor(_count, LIB_MATH_MORTON_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            K x, y, z;
+            mortonQuantize<K>(_points[i], _min, scale, x, y, z);
+            _keys[i] = mortonEncode<K>(x, y, z);
+        }
+    });
+}
+
+template<typename K, typename T>
+void hilbertEncode(const vec3_t<T> *_points, const size_t _count, const vec3_t<T> &_min, const vec3_t<T> &_max, K *_keys)
+{
+    const vec3_t<T> scale = mortonScale<K>(_min, _max);
+    parallelFor(_count, LIB_MATH_MORTON_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            K x, y, z;
+            mortonQuantize<K>(_points[i], _min, scale, x, y, z);
+            _keys[i] = hilbertEncode<K>(x, y, z);
+        }
+    });
+}
+
+#endif // LIB_MATH_MORTON_HPP
@@ -0,0 +1,182 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#include "libMath_instrument.hpp"
+#include "libMath_noise.hpp"
+#include "libMath_parallel.hpp"
+
+#include <algorithm>
+
+template<uint32 D, typename V>
+static float32 noisePoint(const noiseParams_t &_params, const V &_p, V *_derivative)
+{
+    float32 p[D];
+    float32 deriv[D];
+    for (uint32 k = 0; k < D; k++)
+    {
+        p[k] = _p[k];
+    }
+    if (_derivative == nullptr)
+    {
+        return noiseLanes<D, false, float32, uint32>(_params, p, deriv);
+    }
+    const float32 n = noiseLanes<D, true, float32, uint32>(_params, p, deriv);
+    for (uint32 k = 0; k < D; k++)
+    {
+        (*_derivative)[k] = deriv[k];
+    }
+    return n;
+}
+
+// 8 points per lane set, padding lanes repeat the last point
+template<uint32 D, typename V>
+static void noiseRange(const noiseParams_t &_params, const V *_p, float32 *_out, V *_derivatives, const size_t _begin, const size_t _end)
+{
+    alignas(32) float32 lane[D][8];
+    for (size_t base = _begin; base < _end; base += 8)
+    {
+        const size_t n = std::min<size_t>(8, _end - base);
+        float32x8 p[D];
+        float32x8 deriv[D];
+        for (uint32 k = 0; k < D; k++)
+        {
+            for (size_t l = 0; l < 8; l++)
+            {
+                lane[k][l] = _p[base + std::min(l, n - 1)][k];
+            }
+            p[k] = simdLoad(lane[k]);
+        }
+        if (_derivatives == nullptr)
+        {
+            simdStore(lane[0], noiseLanes<D, false, float32x8, uint32x8>(_params, p, deriv));
+            for (size_t l = 0; l < n; l++)
+            {
+                _out[base + l] = lane[0][l];
+            }
+            continue;
+        }
+        const float32x8 r = noiseLanes<D, true, float32x8, uint32x8>(_params, p, deriv);
+        for (uint32 k = 0; k < D; k++)
+        {
+            simdStore(lane[k], deriv[k]);
+        }
+        for (size_t l = 0; l < n; l++)
+        {
+            for (uint32 k = 0; k < D; k++)
+            {
+                _derivatives[base + l][k] = lane[k][l];
+            }
+        }
+        simdStore(lane[0], r);
+        for (size_t l = 0; l < n; l++)
+        {
+            _out[base + l] = lane[0][l];
+        }
+    }
+}
+
+template<uint32 D, typename V>
+static void noiseSpan(const noiseParams_t &_params, const V *_p, float32 *_out, V *_derivatives, const size_t _count)
+{
+    LIB_MATH_INSTRUMENT_SCOPE(INSTRUMENT_NOISE_BATCH, _count);
+    parallelFor(_count, LIB_MATH_NOISE_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        noiseRange<D>(_params, _p, _out, _derivatives, _begin, _end);
+    });
+}
+
+// one grid row [_x0, _x1), _fixed holds the y (and z) coordinates
+template<uint32 D>
+static void noiseRow(const noiseParams_t &_params, const float32 _origin[D], const float32 _spacing[D], const float32 _fixed[D], const uint32 _x0, const uint32 _x1, float32 *_out)
+{
+    alignas(32) float32 lane[8];
+    float32x8 p[D];
+    float32x8 deriv[D];
+    for (uint32 k = 1; k < D; k++)
+    {
+        p[k] = simdSet(_fixed[k]);
+    }
+    for (uint32 x = _x0; x < _x1; x += 8)
+    {
+        const uint32 n = std::min<uint32>(8, _x1 - x);
+        for (uint32 l = 0; l < 8; l++)
+        {
+            lane[l] = _origin[0] + (static_cast<float32>(x + std::min(l, n - 1)) * _spacing[0]);
+        }
+        p[0] = simdLoad(lane);
+        simdStore(lane, noiseLanes<D, false, float32x8, uint32x8>(_params, p, deriv));
+        std::copy(lane, lane + n, _out + x);
+    }
+}
+
+float32 noise(const noiseParams_t &_params, const vec2_t<float32> &_p) { return noisePoint<2, vec2_t<float32>>(_params, _p, nullptr); }
+float32 noise(const noiseParams_t &_params, const vec3_t<float32> &_p) { return noisePoint<3, vec3_t<float32>>(_params, _p, nullptr); }
+float32 noise(const noiseParams_t &_params, const vec4_t<float32> &_p) { return noisePoint<4, vec4_t<float32>>(_params, _p, nullptr); }
+float32 noise(const noiseParams_t &_params, const vec2_t<float32> &_p, vec2_t<float32> &_derivative) { return noisePoint<2>(_params, _p, &_derivative); }
+float32 noise(const noiseParams_t &_params, const vec3_t<float32> &_p, vec3_t<float32> &_derivative) { return noisePoint<3>(_params, _p, &_derivative); }
+float32 noise(const noiseParams_t &_params, const vec4_t<float32> &_p, vec4_t<float32> &_derivative) { return noisePoint<4>(_params, _p, &_derivative); }
+
+void noiseBatch(const noiseParams_t &_params, const vec2_t<float32> *_p, float32 *_out, vec2_t<float32> *_derivatives, const size_t _count) { noiseSpan<2>(_params, _p, _out, _derivatives, _count); }
+void noiseBatch(const noiseParams_t &_params, const vec3_t<float32> *_p, float32 *_out, vec3_t<float32> *_derivatives, const size_t _count) { noiseSpan<3>(_params, _p, _out, _derivatives, _count); }
+void noiseBatch(const noiseParams_t &_params, const vec4_t<float32> *_p, float32 *_out, vec4_t<float32> *_derivatives, const size_t _count) { noiseSpan<4>(_params, _p, _out, _derivatives, _count); }
+
+void noiseGrid(const noiseParams_t &_params, const vec2_t<float32> &_origin, const vec2_t<float32> &_spacing, const uint32 _width, const uint32 _height, float32 *_out)
+{
+    noiseGrid(_params, vec3_t<float32>(_origin.x, _origin.y, 0.0f), vec3_t<float32>(_spacing.x, _spacing.y, 0.0f), _width, _height, 0, _out);
+}
+
+void noiseGrid(const noiseParams_t &_params, const vec3_t<float32> &_origin, const vec3_t<float32> &_spacing, const uint32 _width, const uint32 _height, const uint32 _depth, float32 *_out)
+{
+    // _depth == 0 is the 2D grid
+    const uint32 slices = (_depth > 0) ? _depth : 1;
+    LIB_MATH_INSTRUMENT_SCOPE(INSTRUMENT_NOISE_GRID, static_cast<size_t>(_width) * _height * slices);
+    const uint32 tilesX = (_width + LIB_MATH_NOISE_TILE - 1) / LIB_MATH_NOISE_TILE;
+    const uint32 tilesY = (_height + LIB_MATH_NOISE_TILE - 1) / LIB_MATH_NOISE_TILE;
+    const float32 origin[3]  = { _origin.x, _origin.y, _origin.z };
+    const float32 spacing[3] = { _spacing.x, _spacing.y, _spacing.z };
+    parallelFor(static_cast<size_t>(tilesX) * tilesY * slices, 1, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t tile = _begin; tile < _end; tile++)
+        {
+            const uint32 z  = static_cast<uint32>(tile / (static_cast<size_t>(tilesX) * tilesY));
+            const uint32 ty = static_cast<uint32>((tile / tilesX) % tilesY);
+            const uint32 tx = static_cast<uint32>(tile % tilesX);
+            const uint32 x0 = tx * LIB_MATH_NOISE_TILE;
+            const uint32 x1 = std::min(_width, x0 + LIB_MATH_NOISE_TILE);
+            const uint32 y1 = std::min(_height, (ty + 1) * LIB_MATH_NOISE_TILE);
+            for (uint32 y = ty * LIB_MATH_NOISE_TILE; y < y1; y++)
+            {
+                const float32 fixed[3] = { 0.0f, origin[1] + (static_cast<float32>(y) * spacing[1]), origin[2] + (static_cast<float32>(z) * spacing[2]) };
+                float32 *row = _out + (((static_cast<size_t>(z) * _height) + y) * _width);
+                if (_depth > 0)
+                {
+                    noiseRow<3>(_params, origin, spacing, fixed, x0, x1, row);
+                }
+                else
+                {
+                    noiseRow<2>(_params, origin, spacing, fixed, x0, x1, row);
+                }
+            }
+        }
+    });
+}
@@ -0,0 +1,375 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_OBB_HPP
+#define LIB_MATH_OBB_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_eigen.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_matrix.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#define LIB_MATH_OBB_GRAIN 16384 // minimum points per thread
+
+// Oriented bounding box fitting: the eigenvectors of the point covariance give a first frame, then
+// every frame axis is kept in turn while the other two are replaced by the minimum area rectangle
+// (rotating calipers) of the 2D convex hull of the points projected along it. The smallest of the
+// four boxes wins. Sums run in float64, hulls are built per thread chunk and merged.
+
+template<typename T>
+struct obb_t
+{
+    vec3_t<T> center;
+    vec3_t<T> extents;            // half sizes along the axes
+    mat3_t<T> axes;               // columns are the unit axes, a rotation
+
+    T volume(void) const { return static_cast<T>(8.0) * extents.x * extents.y * extents.z; }
+    vec3_t<T> axis(const uint32 _i) const { return vec3_t<T>(axes.data[0][_i], axes.data[1][_i], axes.data[2][_i]); }
+};
+
+typedef obb_t<float32> obb;
+typedef obb_t<float32> obbf;
+typedef obb_t<float64> obbd;
+
+// functions
+
+// Akl-Toussaint filter, drops points strictly inside the octagon of the extremes along x, y and
+// the diagonals, which leaves only a thin shell of candidates for the hull sort
+template<typename T>
+void obbHullFilter(std::vector<vec2_t<T>> &_points)
+{
+    if (_points.size() < 16)
+    {
+        return;
+    }
+    const T diagonal[8][2] = { { 1.0, 0.0 }, { 1.0, 1.0 }, { 0.0, 1.0 }, { -1.0, 1.0 }, { -1.0, 0.0 }, { -1.0, -1.0 }, { 0.0, -1.0 }, { 1.0, -1.0 } };
+    size_t extreme[8] = {};
+    T best[8];
+    std::fill(best, best + 8, std::numeric_limits<T>::lowest());
+    for (size_t i = 0; i < _points.size(); i++)
+    {
+        for (uint32 k = 0; k < 8; k++)
+        {
+            const T d = (_points[i].x * diagonal[k][0]) + (_points[i].y * diagonal[k][1]);
+            if (d > best[k])
+            {
+                best[k] = d;
+                extreme[k] = i;
+            }
+        }
+    }
+    vec2_t<T> polygon[8];
+    for (uint32 k = 0; k < 8; k++)
+    {
+        polygon[k] = _points[extreme[k]];
+    }
+    size_t kept = 0;
+    for (size_t i = 0; i < _points.size(); i++)
+    {
+        const vec2_t<T> p = _points[i];
+        bool inside = true;
+        for (uint32 k = 0; (k < 8) && inside; k++)
+        {
+            const vec2_t<T> &a = polygon[k];
+            const vec2_t<T> &b = polygon[(k + 1) & 7];
+            inside = (((b.x - a.x) * (p.y - a.y)) - ((b.y - a.y) * (p.x - a.x))) > 0.0;
+        }
+        if (!inside)
+        {
+            _points[kept++] = p;
+        }
+    }
+    _points.resize(kept);
+}
+
+// Andrew's monotone chain, _points are filtered and sorted in place, _hull receives the counter
+// clockwise hull without collinear points
+template<typename T>
+void obbHull(std::vector<vec2_t<T>> &_points, std::vector<vec2_t<T>> &_hull)
+{
+    obbHullFilter(_points);
+    std::sort(_points.begin(), _points.end(), [](const vec2_t<T> &_a, const vec2_t<T> &_b) { return (_a.x < _b.x) || ((_a.x == _b.x) && (_a.y < _b.y)); });
+    _hull.clear();
+    if (_points.size() < 3)
+    {
+        _hull = _points;
+        return;
+    }
+    auto turn = [](const vec2_t<T> &_o, const vec2_t<T> &_a, const vec2_t<T> &_b) { return ((_a.x - _o.x) * (_b.y - _o.y)) - ((_a.y - _o.y) * (_b.x - _o.x)); };
+    _hull.resize(_points.size() * 2);
+    size_t k = 0;
+    for (size_t i = 0; i < _points.size(); i++)
+    {
+        while ((k >= 2) && (turn(_hull[k - 2], _hull[k - 1], _points[i]) <= 0.0))
+        {
+            k--;
+        }
+        _hull[k++] = _points[i];
+    }
+    for (size_t i = _points.size() - 1, lower = k + 1; i > 0; i--)
+    {
+        while ((k >= lower) && (turn(_hull[k - 2], _hull[k - 1], _points[i - 1]) <= 0.0))
+        {
+            k--;
+        }
+        _hull[k++] = _points[i - 1];
+    }
+    _hull.resize(k - 1);
+}
+
+// rotating calipers over a counter clockwise hull, returns the area and the unit edge direction
+// of the minimum area enclosing rectangle
+template<typename T>
+T obbMinRectangle(const std::vector<vec2_t<T>> &_hull, vec2_t<T> &_direction)
+{
+    const size_t m = _hull.size();
+    _direction = vec2_t<T>(1.0, 0.0);
+    if (m < 3)
+    {
+        return 0.0;
+    }
+    auto dot = [](const vec2_t<T> &_a, const vec2_t<T> &_b) { return (_a.x * _b.x) + (_a.y * _b.y); };
+    T best = std::numeric_limits<T>::max();
+    size_t right = 0;
+    size_t top = 0;
+    size_t left = 0;
+    for (size_t i = 0; i < m; i++)
+    {
+        const vec2_t<T> e = _hull[(i + 1) % m] - _hull[i];
+        const T length = std::sqrt(dot(e, e));
+        if (length <= 0.0)
+        {
+            continue;
+        }
+        const vec2_t<T> d(e.x / length, e.y / length);
+        const vec2_t<T> n(-d.y, d.x);
+        if (i == 0)
+        {
+            right = 0;
+        }
+        while (dot(_hull[(right + 1) % m] - _hull[right], d) > 0.0)
+        {
+            right = (right + 1) % m;
+        }
+        if (i == 0)
+        {
+            top = right;
+        }
+        while (dot(_hull[(top + 1) % m] - _hull[top], n) > 0.0)
+        {
+            top = (top + 1) % m;
+        }
+        if (i == 0)
+        {
+            left = top;
+        }
+        while (dot(_hull[(left + 1) % m] - _hull[left], d) < 0.0)
+        {
+            left = (left + 1) % m;
+        }
+        const T area = dot(_hull[right] - _hull[left], d) * dot(_hull[top] - _hull[i], n);
+        if (area < best)
+        {
+            best = area;
+            _direction = d;
+        }
+    }
+    return best;
+}
+
+// box of _axes tightly around the points, _chunks thread chunks
+template<typename T>
+obb_t<T> obbExtents(const vec3_t<T> *_points, const size_t _count, const mat3_t<T> &_axes, const size_t _chunks)
+{
+    std::vector<vec3_t<T>> lo(_chunks, vec3_t<T>(std::numeric_limits<T>::max()));
+    std::vector<vec3_t<T>> hi(_chunks, vec3_t<T>(std::numeric_limits<T>::lowest()));
+    parallelFor(_chunks, 1, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t c = _begin; c < _end; c++)
+        {
+            const size_t end = (_count * (c + 1)) / _chunks;
+            for (size_t i = (_count * c) / _chunks; i < end; i++)
+            {
+                for (uint32 k = 0; k < 3; k++)
+                {
+                    const T d = (_points[i].x * _axes.data[0][k]) + (_points[i].y * _axes.data[1][k]) + (_points[i].z * _axes.data[2][k]);
+                    lo[c][k] = std::min(lo[c][k], d);
+                    hi[c][k] = std::max(hi[c][k], d);
+                }
+            }
+        }
+    });
+    for (size_t c = 1; c < _chunks; c++)
+    {
+        for (uint32 k = 0; k < 3; k++)
+        {
+            lo[0][k] = std::min(lo[0][k], lo[c][k]);
+            hi[0][k] = std::max(hi[0][k], hi[c][k]);
+        }
+    }
+    obb_t<T> box;
+    box.axes = _axes;
+    const vec3_t<T> mid = (lo[0] + hi[0]) * static_cast<T>(0.5);
+    box.extents = (hi[0] - lo[0]) * static_cast<T>(0.5);
+    box.center = vec3_t<T>((_axes.data[0][0] * mid.x) + (_axes.data[0][1] * mid.y) + (_axes.data[0][2] * mid.z),
+                           (_axes.data[1][0] * mid.x) + (_axes.data[1][1] * mid.y) + (_axes.data[1][2] * mid.z),
+                           (_axes.data[2][0] * mid.x) + (_axes.data[2][1] * mid.y) + (_axes.data[2][2] * mid.z));
+    return box;
+}
+
+template<typename T>
+obb_t<T> obbFitChunked(const vec3_t<T> *_points, const size_t _count, const size_t _chunks)
+{
+    if (_count == 0)
+    {
+        return obb_t<T>();
+    }
+    // covariance
+    std::vector<float64> sums(_chunks * 9, 0.0);
+    parallelFor(_chunks, 1, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t c = _begin; c < _end; c++)
+        {
+            float64 *s = sums.data() + (c * 9);
+            const size_t end = (_count * (c + 1)) / _chunks;
+            for (size_t i = (_count * c) / _chunks; i < end; i++)
+            {
+                const float64 x = _points[i].x;
+                const float64 y = _points[i].y;
+                const float64 z = _points[i].z;
+                s[0] += x; s[1] += y; s[2] += z;
+                s[3] += x * x; s[4] += x * y; s[5] += x * z;
+                s[6] += y * y; s[7] += y * z; s[8] += z * z;
+            }
+        }
+    });
+    for (size_t c = 1; c < _chunks; c++)
+    {
+        for (uint32 k = 0; k < 9; k++)
+        {
+            sums[k] += sums[(c * 9) + k];
+        }
+    }
+    const float64 n = static_cast<float64>(_count);
+    const float64 mean[3] = { sums[0] / n, sums[1] / n, sums[2] / n };
+    mat3_t<float64> covariance;
+    const uint32 index[3][3] = { { 3, 4, 5 }, { 4, 6, 7 }, { 5, 7, 8 } };
+    for (uint32 r = 0; r < 3; r++)
+    {
+        for (uint32 c = 0; c < 3; c++)
+        {
+            covariance.data[r][c] = (sums[index[r][c]] / n) - (mean[r] * mean[c]);
+        }
+    }
+    vec3_t<float64> values;
+    mat3_t<float64> vectors;
+    eigenSymmetric(covariance, values, vectors);
+    mat3_t<T> frame;
+    for (uint32 r = 0; r < 3; r++)
+    {
+        for (uint32 c = 0; c < 3; c++)
+        {
+            frame.data[r][c] = static_cast<T>(vectors.data[r][c]);
+        }
+    }
+    obb_t<T> best = obbExtents(_points, _count, frame, _chunks);
+    // hull refinement about each frame axis
+    std::vector<std::vector<vec2_t<T>>> hulls(_chunks);
+    std::vector<vec2_t<T>> merged;
+    std::vector<vec2_t<T>> hull;
+    for (uint32 k = 0; k < 3; k++)
+    {
+        const uint32 a = (k + 1) % 3;
+        const uint32 b = (k + 2) % 3;
+        parallelFor(_chunks, 1, [&](const size_t _begin, const size_t _end)
+        {
+            std::vector<vec2_t<T>> projected;
+            for (size_t c = _begin; c < _end; c++)
+            {
+                const size_t first = (_count * c) / _chunks;
+                const size_t end   = (_count * (c + 1)) / _chunks;
+                projected.resize(end - first);
+                for (size_t i = first; i < end; i++)
+                {
+                    const vec3_t<T> &p = _points[i];
+                    projected[i - first] = vec2_t<T>((p.x * frame.data[0][a]) + (p.y * frame.data[1][a]) + (p.z * frame.data[2][a]),
+                                                     (p.x * frame.data[0][b]) + (p.y * frame.data[1][b]) + (p.z * frame.data[2][b]));
+                }
+                obbHull(projected, hulls[c]);
+            }
+        });
+        merged.clear();
+        for (size_t c = 0; c < _chunks; c++)
+        {
+            merged.insert(merged.end(), hulls[c].begin(), hulls[c].end());
+        }
+        obbHull(merged, hull);
+        vec2_t<T> d;
+        if (obbMinRectangle(hull, d) <= 0.0)
+        {
+            continue;
+        }
+        // rotate axes a and b by the rectangle direction, k stays
+        mat3_t<T> axes = frame;
+        for (uint32 r = 0; r < 3; r++)
+        {
+            axes.data[r][a] = (frame.data[r][a] * d.x) + (frame.data[r][b] * d.y);
+            axes.data[r][b] = (frame.data[r][b] * d.x) - (frame.data[r][a] * d.y);
+        }
+        const obb_t<T> box = obbExtents(_points, _count, axes, _chunks);
+        if (box.volume() < best.volume())
+        {
+            best = box;
+        }
+    }
+    return best;
+}
+
+// one box around a point span, multithreaded
+template<typename T>
+obb_t<T> obbFit(const vec3_t<T> *_points, const size_t _count)
+{
+    return obbFitChunked(_points, _count, std::max<size_t>(1, std::min<size_t>(parallelThreadCount(), _count / LIB_MATH_OBB_GRAIN)));
+}
+
+// object o is fitted to _points[_offsets[o] .. _offsets[o + 1]), objects are spread over threads
+template<typename T>
+void obbFitBatch(const vec3_t<T> *_points, const uint32 *_offsets, const size_t _objectCount, obb_t<T> *_boxes)
+{
+    parallelFor(_objectCount, 1, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t o = _begin; o < _end; o++)
+        {
+            _boxes[o] = obbFitChunked(_points + _offsets[o], _offsets[o + 1] - _offsets[o], 1);
+        }
+    });
+}
+
+#endif // LIB_MATH_OBB_HPP
@@ -0,0 +1,190 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#include "libMath_parallel.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Workers sleep on parallelWake until the generation changes. A job is open from its publication
+// until the caller has finished its own ranges, only workers joining while it is open touch it and
+// the caller waits for all of them to leave before the job's function goes out of scope. The first
+// exception thrown by a range, on any thread, skips the remaining ranges and is rethrown by the
+// caller once the workers have left.
+struct parallelPool
+{
+    std::mutex               mutex;
+    std::condition_variable  wake;
+    std::condition_variable  idle;
+    std::vector<std::thread> workers;
+    std::mutex               submit;       // one job at a time
+    uint64                   generation = 0;
+    uint32                   active     = 0; // workers inside the open job
+    bool                     open       = false;
+    bool                     stop       = false;
+    size_t                   count      = 0;
+    size_t                   step       = 0;
+    size_t                   ranges     = 0;
+    parallelInvoke           invoke     = nullptr;
+    void                    *context    = nullptr;
+    std::atomic<size_t>      next       = 0;
+    std::exception_ptr       failure;       // first exception of the open job
+
+    parallelPool(void);
+    ~parallelPool(void);
+    void work(void);
+    void take(const size_t _count, const size_t _step, const size_t _ranges, parallelInvoke _invoke, void *_context);
+};
+
+static thread_local bool parallelInJob = false;
+
+parallelPool::parallelPool(void)
+{
+    const uint32 threads = parallelThreadCount();
+    workers.reserve(threads - 1);
+    for (uint32 i = 1; i < threads; i++)
+    {
+        workers.emplace_back([this]() { work(); });
+    }
+}
+
+parallelPool::~parallelPool(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    wake.notify_all();
+    for (size_t i = 0; i < workers.size(); i++)
+    {
+        workers[i].join();
+    }
+}
+
+void parallelPool::take(const size_t _count, const size_t _step, const size_t _ranges, parallelInvoke _invoke, void *_context)
+{
+    try
+    {
+        for (size_t r = next.fetch_add(1, std::memory_order_relaxed); r < _ranges; r = next.fetch_add(1, std::memory_order_relaxed))
+        {
+            const size_t begin = r * _step;
+            _invoke(_context, begin, std::min(_count, begin + _step));
+        }
+    }
+    catch (...)
+    {
+        next.store(_ranges, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!failure)
+        {
+            failure = std::current_exception();
+        }
+    }
+}
+
+void parallelPool::work(void)
+{
+    parallelInJob = true;
+    uint64 seen = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;)
+    {
+        wake.wait(lock, [&]() { return stop || (generation != seen); });
+        if (stop)
+        {
+            return;
+        }
+        seen = generation;
+        if (!open)
+        {
+            continue;
+        }
+        active++;
+        const size_t         jobCount   = count;
+        const size_t         jobStep    = step;
+        const size_t         jobRanges  = ranges;
+        const parallelInvoke jobInvoke  = invoke;
+        void                *jobContext = context;
+        lock.unlock();
+        take(jobCount, jobStep, jobRanges, jobInvoke, jobContext);
+        lock.lock();
+        if ((--active == 0) && !open)
+        {
+            idle.notify_one();
+        }
+    }
+}
+
+uint32 parallelThreadCount(void)
+{
+    static const uint32 count = std::max<uint32>(std::thread::hardware_concurrency(), 1);
+    return count;
+}
+
+void parallelRun(const size_t _count, const size_t _step, parallelInvoke _invoke, void *_context)
+{
+    static parallelPool pool;
+    if (parallelInJob)
+    {
+        _invoke(_context, 0, _count);
+        return;
+    }
+    std::unique_lock<std::mutex> submit(pool.submit, std::try_to_lock);
+    if (!submit.owns_lock())
+    {
+        _invoke(_context, 0, _count);
+        return;
+    }
+    const size_t ranges = (_count + _step - 1) / _step;
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.count   = _count;
+        pool.step    = _step;
+        pool.ranges  = ranges;
+        pool.invoke  = _invoke;
+        pool.context = _context;
+        pool.next.store(0, std::memory_order_relaxed);
+        pool.open    = true;
+        pool.generation++;
+    }
+    pool.wake.notify_all();
+    parallelInJob = true;
+    pool.take(_count, _step, ranges, _invoke, _context);
+    parallelInJob = false;
+    std::exception_ptr failure;
+    {
+        std::unique_lock<std::mutex> lock(pool.mutex);
+        pool.open = false;
+        pool.idle.wait(lock, [&]() { return pool.active == 0; });
+        std::swap(failure, pool.failure);
+    }
+    if (failure)
+    {
+        std::rethrow_exception(failure);
+    }
+}
@@ -0,0 +1,78 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_PARALLEL_HPP
+#define LIB_MATH_PARALLEL_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_simd.hpp"
+
+#include <algorithm>
+
+// Persistent worker pool behind parallelFor(): parallelThreadCount() - 1 workers are started on the
+// first parallel call and live until exit. A job is a fixed split of [0, count) into ranges of
+// step elements, the workers and the calling thread take ranges until none are left. Nothing is
+// allocated per call. A call made from inside a job, or while another thread's job is running,
+// runs on the calling thread as a single range.
+
+typedef void (*parallelInvoke)(void *_context, const size_t _begin, const size_t _end);
+
+uint32 parallelThreadCount(void);
+void parallelRun(const size_t _count, const size_t _step, parallelInvoke _invoke, void *_context);
+
+// Splits [0, _count) into one contiguous range per thread, ranges smaller than _grain are not split.
+// _func(begin, end) may run on any thread, the call returns once all ranges are done. If _func
+// throws, ranges not yet started are skipped and the first exception is rethrown here.
+template<typename F>
+void parallelFor(const size_t _count, const size_t _grain, F &&_func)
+{
+    if (_count == 0)
+    {
+        return;
+    }
+    const size_t grain   = (_grain > 0) ? _grain : 1;
+    const size_t threads = std::min<size_t>((_count + grain - 1) / grain, parallelThreadCount());
+    if (threads <= 1)
+    {
+        _func(static_cast<size_t>(0), _count);
+        return;
+    }
+    typedef std::remove_reference_t<F> function_t;
+    parallelRun(_count, (_count + threads - 1) / threads, [](void *_context, const size_t _begin, const size_t _end)
+    {
+        (*static_cast<function_t *>(_context))(_begin, _end);
+    }, const_cast<void *>(static_cast<const void *>(&_func)));
+}
+
+// parallelFor calling simdForLanes() on every range
+template<typename T, typename F>
+void parallelForLanes(const size_t _count, const size_t _grain, F &&_func)
+{
+    parallelFor(_count, _grain, [&](const size_t _begin, const size_t _end)
+    {
+        simdForLanes<T>(_begin, _end, _func);
+    });
+}
+
+#endif // LIB_MATH_PARALLEL_HPP
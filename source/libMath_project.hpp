@@ -0,0 +1,279 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_PROJECT_HPP
+#define LIB_MATH_PROJECT_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_matrix.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_simd.hpp"
+#include "libMath_transform.hpp"
+#include "libMath_vector.hpp"
+
+#include <type_traits>
+
+#define LIB_MATH_PROJECT_GRAIN 8192 // minimum points per thread
+
+// Batch projection of world points through a view-projection matrix to window coordinates and
+// unprojection of window points back to world points / rays through its inverse. float32 batches
+// run 8 points per float32x8, float64 runs scalar lanes, both spread over threads.
+// Window x / y = ndc * scale + offset, window depth maps the ndc depth range [min(ndcNear, ndcFar), 1]
+// linearly onto [minDepth, maxDepth] like the GPU depth range does, so reverse-Z depth stays reversed.
+
+enum frustumBit : uint8
+{
+    FRUSTUM_LEFT   = 1,
+    FRUSTUM_RIGHT  = 2,
+    FRUSTUM_BOTTOM = 4,
+    FRUSTUM_TOP    = 8,
+    FRUSTUM_NEAR   = 16,
+    FRUSTUM_FAR    = 32
+};
+
+template<typename T>
+struct viewport_t
+{
+    vec3_t<T> scale;
+    vec3_t<T> offset;
+    vec3_t<T> invScale;
+    T ndcNear = -1.0; // ndc depth of the near plane, -1 for perspective(), 0 for [0, 1] depth, 1 for reverse-Z
+    T ndcFar  = 1.0;  // ndc depth of the far plane
+
+    // y grows upwards, pass a negative _height (and _y at the top edge) for y down windows
+    constexpr viewport_t(const T _x, const T _y, const T _width, const T _height, const T _minDepth = 0.0, const T _maxDepth = 1.0, const T _ndcNear = -1.0, const T _ndcFar = 1.0) : ndcNear(_ndcNear), ndcFar(_ndcFar)
+    {
+        const T low = (_ndcNear < _ndcFar) ? _ndcNear : _ndcFar;
+        scale    = vec3_t<T>(_width * static_cast<T>(0.5), _height * static_cast<T>(0.5), (_maxDepth - _minDepth) / (static_cast<T>(1.0) - low));
+        offset   = vec3_t<T>(_x + scale.x, _y + scale.y, _minDepth - (low * scale.z));
+        invScale = vec3_t<T>(static_cast<T>(1.0) / scale.x, static_cast<T>(1.0) / scale.y, static_cast<T>(1.0) / scale.z);
+    }
+};
+
+// functions
+
+// _out = _m * (_in, 1), rows of _m splatted in _m[r * 4 + c]
+template<typename L>
+inline void projectTransform(const L _m[16], const L _x, const L _y, const L _z, L _out[4])
+{
+    for (uint32 r = 0; r < 4; r++)
+    {
+        _out[r] = simdMadd(_m[(r * 4) + 0], _x, simdMadd(_m[(r * 4) + 1], _y, simdMadd(_m[(r * 4) + 2], _z, _m[(r * 4) + 3])));
+    }
+}
+
+template<typename L, typename T>
+inline void projectSplat(const mat4_t<T> &_m, L _out[16])
+{
+    for (uint32 r = 0; r < 4; r++)
+    {
+        for (uint32 c = 0; c < 4; c++)
+        {
+            _out[(r * 4) + c] = simdSplat<L>(_m.data[r][c]);
+        }
+    }
+}
+
+template<typename L>
+inline uint32 projectBits(const L &_mask)
+{
+    if constexpr (std::is_same<L, float32x8>::value)
+    {
+        return simdMaskBits(_mask);
+    }
+    else
+    {
+        return _mask ? 1 : 0;
+    }
+}
+
+// window coordinates (x, y, depth) of each point, _outside (optional) receives frustumBit flags,
+// window coordinates of points with FRUSTUM_NEAR set (behind the eye) are meaningless
+template<typename T>
+void projectBatch(const mat4_t<T> &_viewProjection, const viewport_t<T> &_viewport, const vec3_t<T> *_points, const size_t _count, vec3_t<T> *_window, uint8 *_outside = nullptr)
+{
+    const T low = (_viewport.ndcNear < _viewport.ndcFar) ? _viewport.ndcNear : _viewport.ndcFar;
+    const uint8 lowBit  = (_viewport.ndcNear < _viewport.ndcFar) ? FRUSTUM_NEAR : FRUSTUM_FAR;
+    const uint8 highBit = (_viewport.ndcNear < _viewport.ndcFar) ? FRUSTUM_FAR : FRUSTUM_NEAR;
+    parallelForLanes<T>(_count, LIB_MATH_PROJECT_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        constexpr uint32 lanes = std::is_same<L, float32x8>::value ? 8 : 1;
+        L m[16];
+        L p[3];
+        L c[4];
+        projectSplat<L>(_viewProjection, m);
+        simdLoadVec<L>(_points, _i, p);
+        projectTransform<L>(m, p[0], p[1], p[2], c);
+        const L invW = simdSplat<L>(1.0) / c[3];
+        for (uint32 k = 0; k < 3; k++)
+        {
+            p[k] = simdMadd(c[k] * invW, simdSplat<L>(_viewport.scale[k]), simdSplat<L>(_viewport.offset[k]));
+        }
+        simdStoreVec<L>(_window, _i, p);
+        if (_outside != nullptr)
+        {
+            const L negW = -c[3];
+            const uint32 bits[6] =
+            {
+                projectBits<L>(simdLess(c[0], negW)),
+                projectBits<L>(simdGreater(c[0], c[3])),
+                projectBits<L>(simdLess(c[1], negW)),
+                projectBits<L>(simdGreater(c[1], c[3])),
+                projectBits<L>(simdLess(c[2], simdSplat<L>(low) * c[3])),
+                projectBits<L>(simdGreater(c[2], c[3]))
+            };
+            const uint8 flag[6] = { FRUSTUM_LEFT, FRUSTUM_RIGHT, FRUSTUM_BOTTOM, FRUSTUM_TOP, lowBit, highBit };
+            for (uint32 l = 0; l < lanes; l++)
+            {
+                uint8 outside = 0;
+                for (uint32 b = 0; b < 6; b++)
+                {
+                    outside |= ((bits[b] >> l) & 1) ? flag[b] : 0;
+                }
+                _outside[_i + l] = outside;
+            }
+        }
+    });
+}
+
+// world points of window coordinates (x, y, depth)
+template<typename T>
+void unprojectBatch(const mat4_t<T> &_inverseViewProjection, const viewport_t<T> &_viewport, const vec3_t<T> *_window, const size_t _count, vec3_t<T> *_points)
+{
+    parallelForLanes<T>(_count, LIB_MATH_PROJECT_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        L m[16];
+        L p[3];
+        L h[4];
+        projectSplat<L>(_inverseViewProjection, m);
+        simdLoadVec<L>(_window, _i, p);
+        for (uint32 k = 0; k < 3; k++)
+        {
+            p[k] = (p[k] - simdSplat<L>(_viewport.offset[k])) * simdSplat<L>(_viewport.invScale[k]);
+        }
+        projectTransform<L>(m, p[0], p[1], p[2], h);
+        const L invW = simdSplat<L>(1.0) / h[3];
+        for (uint32 k = 0; k < 3; k++)
+        {
+            p[k] = h[k] * invW;
+        }
+        simdStoreVec<L>(_points, _i, p);
+    });
+}
+
+// world rays through window points (x, y): origin on the near plane, unit direction towards the
+// far plane, also valid for infinite far planes (ndc far maps to w = 0)
+template<typename T>
+void unprojectBatch(const mat4_t<T> &_inverseViewProjection, const viewport_t<T> &_viewport, const vec2_t<T> *_window, const size_t _count, vec3_t<T> *_origins, vec3_t<T> *_directions)
+{
+    parallelForLanes<T>(_count, LIB_MATH_PROJECT_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        L m[16];
+        L s[2];
+        L n[4];
+        L f[4];
+        projectSplat<L>(_inverseViewProjection, m);
+        simdLoadVec<L>(_window, _i, s);
+        for (uint32 k = 0; k < 2; k++)
+        {
+            s[k] = (s[k] - simdSplat<L>(_viewport.offset[k])) * simdSplat<L>(_viewport.invScale[k]);
+        }
+        projectTransform<L>(m, s[0], s[1], simdSplat<L>(_viewport.ndcNear), n);
+        projectTransform<L>(m, s[0], s[1], simdSplat<L>(_viewport.ndcFar), f);
+        const L invW = simdSplat<L>(1.0) / n[3];
+        L o[3];
+        L d[3];
+        for (uint32 k = 0; k < 3; k++)
+        {
+            o[k] = n[k] * invW;
+            d[k] = f[k] - (o[k] * f[3]);
+        }
+        const L norm = simdSplat<L>(1.0) / simdSqrt((d[0] * d[0]) + (d[1] * d[1]) + (d[2] * d[2]));
+        for (uint32 k = 0; k < 3; k++)
+        {
+            d[k] = d[k] * norm;
+        }
+        simdStoreVec<L>(_origins, _i, o);
+        simdStoreVec<L>(_directions, _i, d);
+    });
+}
+
+// view space z of depth buffer values in [0, 1] written through a projection_t matrix,
+// z = depthOffset / (ndc - depthScale) folded into one multiply-add and a reciprocal
+template<typename T>
+void linearDepthBatch(const projection_t<T> &_projection, const T *_depth, const size_t _count, T *_linear)
+{
+    const T low = (_projection.ndcNear < _projection.ndcFar) ? _projection.ndcNear : _projection.ndcFar;
+    const T slope  = (static_cast<T>(1.0) - low) / _projection.depthOffset;
+    const T offset = (low - _projection.depthScale) / _projection.depthOffset;
+    parallelForLanes<T>(_count, LIB_MATH_PROJECT_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        const L d = simdLoadAt<L>(_depth, _i);
+        simdStoreAt<L>(_linear, _i, simdSplat<L>(1.0) / simdMadd(d, simdSplat<L>(slope), simdSplat<L>(offset)));
+    });
+}
+
+// positions of a _width x _height depth buffer (row 0 at the top, samples at pixel centres),
+// _inverseView takes view space to world space, pass mat4_t<T>(1) for view space positions
+template<typename T>
+void depthToPositions(const projection_t<T> &_projection, const mat4_t<T> &_inverseView, const T *_depth, const uint32 _width, const uint32 _height, vec3_t<T> *_positions)
+{
+    const T low = (_projection.ndcNear < _projection.ndcFar) ? _projection.ndcNear : _projection.ndcFar;
+    const T slope  = (static_cast<T>(1.0) - low) / _projection.depthOffset;
+    const T offset = (low - _projection.depthScale) / _projection.depthOffset;
+    // view x = ndc x * z / focal x, ndc x = (x + 0.5) * 2 / width - 1
+    const T scaleX  = (static_cast<T>(2.0) / static_cast<T>(_width)) * _projection.inverse.data[0][0];
+    const T offsetX = (static_cast<T>(1.0) / static_cast<T>(_width) - static_cast<T>(1.0)) * _projection.inverse.data[0][0];
+    const T scaleY  = (static_cast<T>(-2.0) / static_cast<T>(_height)) * _projection.inverse.data[1][1];
+    const T offsetY = (static_cast<T>(1.0) - static_cast<T>(1.0) / static_cast<T>(_height)) * _projection.inverse.data[1][1];
+    parallelForLanes<T>(static_cast<size_t>(_width) * _height, LIB_MATH_PROJECT_GRAIN, [&](auto _lane, const size_t _i)
+    {
+        using L = decltype(_lane);
+        constexpr uint32 lanes = std::is_same<L, float32x8>::value ? 8 : 1;
+        T px[lanes];
+        T py[lanes];
+        for (uint32 l = 0; l < lanes; l++)
+        {
+            px[l] = static_cast<T>((_i + l) % _width);
+            py[l] = static_cast<T>((_i + l) / _width);
+        }
+        L m[16];
+        L p[3];
+        projectSplat<L>(_inverseView, m);
+        const L z = simdSplat<L>(1.0) / simdMadd(simdLoadAt<L>(_depth, _i), simdSplat<L>(slope), simdSplat<L>(offset));
+        const L x = simdMadd(simdLoadAt<L>(px, 0), simdSplat<L>(scaleX), simdSplat<L>(offsetX)) * z;
+        const L y = simdMadd(simdLoadAt<L>(py, 0), simdSplat<L>(scaleY), simdSplat<L>(offsetY)) * z;
+        for (uint32 r = 0; r < 3; r++)
+        {
+            p[r] = simdMadd(m[(r * 4) + 0], x, simdMadd(m[(r * 4) + 1], y, simdMadd(m[(r * 4) + 2], z, m[(r * 4) + 3])));
+        }
+        simdStoreVec<L>(_positions, _i, p);
+    });
+}
+
+#endif // LIB_MATH_PROJECT_HPP
@@ -0,0 +1,30 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#include "libMath_quaternion.hpp"
+
+// layout checks, bone palettes are copied with bulkCopy() and uploaded as packed floats
+static_assert(std::is_trivially_copyable<quaternion<float32>>::value && std::is_standard_layout<quaternion<float32>>::value);
+static_assert(std::is_trivially_copyable<quaternion<float64>>::value && std::is_standard_layout<quaternion<float64>>::value);
+static_assert(std::is_trivially_copyable<dualQuaternion<float32>>::value && std::is_standard_layout<dualQuaternion<float32>>::value);
+static_assert(std::is_trivially_copyable<dualQuaternion<float64>>::value && std::is_standard_layout<dualQuaternion<float64>>::value);
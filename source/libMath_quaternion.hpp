@@ -26,6 +26,8 @@
 
 #include "libMath_defines.hpp"
 #include "libMath_includes.hpp"
+#include "libMath_matrix.hpp"
+#include "libMath_vector.hpp"
 
 template<typename T>
 struct quaternion
@@ -39,14 +41,200 @@ struct quaternion
     };
     
     // construnctors and destructor
-    quaternion(void) { this->s = 0.0; this->v = vec3_t<T>(0.0); }
+    constexpr quaternion(void) : s(0.0), v(0.0) { }
+    constexpr quaternion(const T _s, const vec3_t<T> &_v) : s(_s), v(_v) { }
+    constexpr quaternion(const T _s, const T _x, const T _y, const T _z) : s(_s), v(_x, _y, _z) { }
     ~quaternion(void) = default;
     
     // opperators
+    constexpr bool operator==(const quaternion& _q) const { return (s == _q.s && v == _q.v); }
+    constexpr quaternion operator- (void) const { return quaternion(-s, -v); }
+    constexpr quaternion operator+(const quaternion& _q) const { return quaternion(s + _q.s, v + _q.v); }
+    constexpr void operator+=(const quaternion& _q) { s += _q.s; v += _q.v; }
+    constexpr quaternion operator-(const quaternion& _q) const { return quaternion(s - _q.s, v - _q.v); }
+    constexpr void operator-=(const quaternion& _q) { s -= _q.s; v -= _q.v; }
+    constexpr quaternion operator*(const T _s) const { return quaternion(s * _s, v * _s); }
+    constexpr void operator*=(const T _s) { s *= _s; v *= _s; }
+    constexpr quaternion operator*(const quaternion& _q) const { return quaternion((s * _q.s) - v.dot(_q.v), (_q.v * s) + (v * _q.s) + v.cross(_q.v)); }
+    constexpr void operator*=(const quaternion& _q) { *this = *this * _q; }
 
     // functions
-    uint32 size(void) { return SIZE; }
+    constexpr uint32 size(void) const { return SIZE; }
+    constexpr T dot(const quaternion& _q) const { return (s * _q.s) + v.dot(_q.v); }
+    constexpr quaternion conjugate(void) const { return quaternion(s, -v); }
+    T length(void) const { return std::sqrt(dot(*this)); }
+    void normalize(void) { T l = length(); if (l > 0.0) { T il = 1.0 / l; s *= il; v *= il; } }
+    quaternion normalized(void) const { quaternion q = *this; q.normalize(); return q; }
+
+    // rotates _p by this unit quaternion
+    constexpr vec3_t<T> rotate(const vec3_t<T> &_p) const { vec3_t<T> t = v.cross(_p) * 2.0; return _p + (t * s) + v.cross(t); }
+
+    constexpr mat3_t<T> toMat3(void) const
+    {
+        const T xx = v.x * v.x; const T yy = v.y * v.y; const T zz = v.z * v.z;
+        const T xy = v.x * v.y; const T xz = v.x * v.z; const T yz = v.y * v.z;
+        const T sx = s * v.x;   const T sy = s * v.y;   const T sz = s * v.z;
+        mat3_t<T> tMat3(1);
+        tMat3.setRC(1.0 - 2.0 * (yy + zz), 2.0 * (xy - sz),       2.0 * (xz + sy),
+                    2.0 * (xy + sz),       1.0 - 2.0 * (xx + zz), 2.0 * (yz - sx),
+                    2.0 * (xz - sy),       2.0 * (yz + sx),       1.0 - 2.0 * (xx + yy));
+        return tMat3;
+    }
+
+    constexpr mat4_t<T> toMat4(void) const
+    {
+        const mat3_t<T> tMat3 = toMat3();
+        mat4_t<T> tMat4(1);
+        for (size_t i = 0; i < 3; i++)
+        {
+            for (size_t j = 0; j < 3; j++)
+            {
+                tMat4.data[i][j] = tMat3.data[i][j];
+            }
+        }
+        return tMat4;
+    }
+
+    // rotation part of a matrix, the upper 3x3 is expected to be orthonormal
+    static quaternion fromRotation(const T _m00, const T _m01, const T _m02,
+                                   const T _m10, const T _m11, const T _m12,
+                                   const T _m20, const T _m21, const T _m22)
+    {
+        const T trace = _m00 + _m11 + _m22;
+        quaternion q;
+        if (trace > 0.0)
+        {
+            const T f = std::sqrt(trace + 1.0) * 2.0;
+            q = quaternion(0.25 * f, (_m21 - _m12) / f, (_m02 - _m20) / f, (_m10 - _m01) / f);
+        }
+        else if ((_m00 > _m11) && (_m00 > _m22))
+        {
+            const T f = std::sqrt(1.0 + _m00 - _m11 - _m22) * 2.0;
+            q = quaternion((_m21 - _m12) / f, 0.25 * f, (_m01 + _m10) / f, (_m02 + _m20) / f);
+        }
+        else if (_m11 > _m22)
+        {
+            const T f = std::sqrt(1.0 + _m11 - _m00 - _m22) * 2.0;
+            q = quaternion((_m02 - _m20) / f, (_m01 + _m10) / f, 0.25 * f, (_m12 + _m21) / f);
+        }
+        else
+        {
+            const T f = std::sqrt(1.0 + _m22 - _m00 - _m11) * 2.0;
+            q = quaternion((_m10 - _m01) / f, (_m02 + _m20) / f, (_m12 + _m21) / f, 0.25 * f);
+        }
+        q.normalize();
+        return q;
+    }
+
+    static quaternion fromMat3(const mat3_t<T> &_m)
+    {
+        return fromRotation(_m.data[0][0], _m.data[0][1], _m.data[0][2],
+                            _m.data[1][0], _m.data[1][1], _m.data[1][2],
+                            _m.data[2][0], _m.data[2][1], _m.data[2][2]);
+    }
+
+    static quaternion fromMat4(const mat4_t<T> &_m)
+    {
+        return fromRotation(_m.data[0][0], _m.data[0][1], _m.data[0][2],
+                            _m.data[1][0], _m.data[1][1], _m.data[1][2],
+                            _m.data[2][0], _m.data[2][1], _m.data[2][2]);
+    }
+
+    static quaternion fromAxisAngle(const vec3_t<T> &_axis, const T _angle)
+    {
+        const T h = _angle * 0.5;
+        return quaternion(std::cos(h), _axis * std::sin(h));
+    }
+
+    // shortest path interpolation of unit quaternions
+    static quaternion nlerp(const quaternion &_a, const quaternion &_b, const T _t)
+    {
+        const quaternion b = (_a.dot(_b) < 0.0) ? -_b : _b;
+        return ((_a * (1.0 - _t)) + (b * _t)).normalized();
+    }
+
+    // constant angular velocity, nearly parallel rotations fall back to nlerp()
+    static quaternion slerp(const quaternion &_a, const quaternion &_b, const T _t)
+    {
+        T d = _a.dot(_b);
+        const quaternion b = (d < 0.0) ? -_b : _b;
+        d = std::fabs(d);
+        if (d > 0.9995)
+        {
+            return ((_a * (1.0 - _t)) + (b * _t)).normalized();
+        }
+        const T theta = std::acos(d);
+        const T is    = 1.0 / std::sin(theta);
+        return (_a * (std::sin((1.0 - _t) * theta) * is)) + (b * (std::sin(_t * theta) * is));
+    }
 };
 
-#endif // LIB_MATH_QUATERNION_HPP
+// rigid transform as real (rotation) and dual (translation) quaternion parts
+template<typename T>
+struct dualQuaternion
+{
+    // data structures, variables and constants
+    static const uint32 SIZE = 8; // dualQuaternion == 8
+    quaternion<T> real;
+    quaternion<T> dual;
+
+    // construnctors and destructor
+    constexpr dualQuaternion(void) : real(1.0, 0.0, 0.0, 0.0), dual() { }
+    constexpr dualQuaternion(const quaternion<T> &_real, const quaternion<T> &_dual) : real(_real), dual(_dual) { }
+    constexpr dualQuaternion(const quaternion<T> &_rotation, const vec3_t<T> &_translation) : real(_rotation), dual((quaternion<T>(0.0, _translation) * _rotation) * 0.5) { }
+    ~dualQuaternion(void) = default;
+
+    // opperators
+    constexpr dualQuaternion operator+(const dualQuaternion& _d) const { return dualQuaternion(real + _d.real, dual + _d.dual); }
+    constexpr void operator+=(const dualQuaternion& _d) { real += _d.real; dual += _d.dual; }
+    constexpr dualQuaternion operator*(const T _s) const { return dualQuaternion(real * _s, dual * _s); }
+    constexpr dualQuaternion operator*(const dualQuaternion& _d) const { return dualQuaternion(real * _d.real, (real * _d.dual) + (dual * _d.real)); }
+
+    // functions
+    constexpr uint32 size(void) const { return SIZE; }
+    constexpr dualQuaternion conjugate(void) const { return dualQuaternion(real.conjugate(), dual.conjugate()); }
+    void normalize(void) { T l = real.length(); if (l > 0.0) { T il = 1.0 / l; real *= il; dual *= il; } }
+    dualQuaternion normalized(void) const { dualQuaternion d = *this; d.normalize(); return d; }
+    constexpr vec3_t<T> translation(void) const { return ((real.v * -dual.s) + (dual.v * real.s) + real.v.cross(dual.v)) * 2.0; }
+    constexpr vec3_t<T> transformPoint(const vec3_t<T> &_p) const { return real.rotate(_p) + translation(); }
+    constexpr vec3_t<T> transformVector(const vec3_t<T> &_v) const { return real.rotate(_v); }
+
+    constexpr mat4_t<T> toMat4(void) const
+    {
+        mat4_t<T> tMat4 = real.toMat4();
+        const vec3_t<T> t = translation();
+        tMat4.data[0][3] = t.x;
+        tMat4.data[1][3] = t.y;
+        tMat4.data[2][3] = t.z;
+        return tMat4;
+    }
+
+    // weighted blend, antipodal rotations are flipped onto the first one's hemisphere
+    static dualQuaternion blend(const dualQuaternion *_d, const T *_weights, const uint32 _count)
+    {
+        dualQuaternion tDual = dualQuaternion(quaternion<T>(), quaternion<T>());
+        for (uint32 i = 0; i < _count; i++)
+        {
+            const T w = (_d[0].real.dot(_d[i].real) < 0.0) ? -_weights[i] : _weights[i];
+            tDual += _d[i] * w;
+        }
+        tDual.normalize();
+        return tDual;
+    }
 
+    // rigid (rotation and translation only) matrix
+    static dualQuaternion fromMat4(const mat4_t<T> &_m)
+    {
+        return dualQuaternion(quaternion<T>::fromMat4(_m), vec3_t<T>(_m.data[0][3], _m.data[1][3], _m.data[2][3]));
+    }
+};
+
+typedef quaternion<float32> quat;
+typedef quaternion<float32> quatf;
+typedef quaternion<float64> quatd;
+
+typedef dualQuaternion<float32> dualQuat;
+typedef dualQuaternion<float32> dualQuatf;
+typedef dualQuaternion<float64> dualQuatd;
+
+#endif // LIB_MATH_QUATERNION_HPP
@@ -0,0 +1,141 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_RADIX_HPP
+#define LIB_MATH_RADIX_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_parallel.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#define LIB_MATH_RADIX_GRAIN 65536 // minimum keys per thread
+
+// Stable LSD radix sort of unsigned keys (uint32 / uint64) in 8 bit digits. Each pass counts
+// digits per thread chunk, prefix sums the counts digit-major / chunk-minor and scatters every
+// chunk from its own offsets, so the result does not depend on the thread count. Passes where all
+// keys share the digit are skipped (30-bit Morton keys need 4 passes, 63-bit ones up to 8).
+
+// _keys are sorted in place, _permutation[i] receives the original index of the key now at i
+template<typename K>
+void radixSort(K *_keys, const size_t _count, uint32 *_permutation)
+{
+    const size_t chunks = std::max<size_t>(1, std::min<size_t>(parallelThreadCount(), _count / LIB_MATH_RADIX_GRAIN));
+    std::vector<K> keys(_count);
+    std::vector<uint32> permutation(_count);
+    std::vector<size_t> histogram(chunks * 256);
+    K *srcKeys = _keys;
+    K *dstKeys = keys.data();
+    uint32 *srcPermutation = _permutation;
+    uint32 *dstPermutation = permutation.data();
+    parallelFor(_count, LIB_MATH_RADIX_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            _permutation[i] = static_cast<uint32>(i);
+        }
+    });
+    for (uint32 shift = 0; shift < (sizeof(K) * 8); shift += 8)
+    {
+        std::fill(histogram.begin(), histogram.end(), 0);
+        parallelFor(chunks, 1, [&](const size_t _begin, const size_t _end)
+        {
+            for (size_t c = _begin; c < _end; c++)
+            {
+                size_t *counts = histogram.data() + (c * 256);
+                const size_t end = (_count * (c + 1)) / chunks;
+                for (size_t i = (_count * c) / chunks; i < end; i++)
+                {
+                    counts[(srcKeys[i] >> shift) & 0xff]++;
+                }
+            }
+        });
+        bool single = false;
+        size_t sum = 0;
+        for (uint32 d = 0; d < 256; d++)
+        {
+            const size_t first = sum;
+            for (size_t c = 0; c < chunks; c++)
+            {
+                const size_t n = histogram[(c * 256) + d];
+                histogram[(c * 256) + d] = sum;
+                sum += n;
+            }
+            single = single || ((sum - first) == _count);
+        }
+        if (single)
+        {
+            continue;
+        }
+        parallelFor(chunks, 1, [&](const size_t _begin, const size_t _end)
+        {
+            for (size_t c = _begin; c < _end; c++)
+            {
+                size_t *offsets = histogram.data() + (c * 256);
+                const size_t end = (_count * (c + 1)) / chunks;
+                for (size_t i = (_count * c) / chunks; i < end; i++)
+                {
+                    const size_t o = offsets[(srcKeys[i] >> shift) & 0xff]++;
+                    dstKeys[o]        = srcKeys[i];
+                    dstPermutation[o] = srcPermutation[i];
+                }
+            }
+        });
+        std::swap(srcKeys, dstKeys);
+        std::swap(srcPermutation, dstPermutation);
+    }
+    if (srcKeys != _keys)
+    {
+        parallelFor(_count, LIB_MATH_RADIX_GRAIN, [&](const size_t _begin, const size_t _end)
+        {
+            std::copy(srcKeys + _begin, srcKeys + _end, _keys + _begin);
+            std::copy(srcPermutation + _begin, srcPermutation + _end, _permutation + _begin);
+        });
+    }
+}
+
+// _out[i] = _in[_permutation[i]], _out must not alias _in, multithreaded
+template<typename T>
+void radixReorder(const uint32 *_permutation, const T *_in, T *_out, const size_t _count)
+{
+    parallelFor(_count, LIB_MATH_RADIX_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            _out[i] = _in[_permutation[i]];
+        }
+    });
+}
+
+// reorders a companion array in place (through a temporary copy)
+template<typename T>
+void radixReorder(const uint32 *_permutation, std::vector<T> &_data)
+{
+    std::vector<T> out(_data.size());
+    radixReorder(_permutation, _data.data(), out.data(), _data.size());
+    _data.swap(out);
+}
+
+#endif // LIB_MATH_RADIX_HPP
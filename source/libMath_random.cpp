@@ -0,0 +1,219 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#include "libMath_parallel.hpp"
+#include "libMath_random.hpp"
+
+#include <algorithm>
+
+// _func(generator, begin, end) per block, block b uses stream b
+template<typename F>
+static void randomBlocks(const uint64 _seed, const size_t _count, F &&_func)
+{
+    const size_t blocks = (_count + LIB_MATH_RANDOM_BLOCK - 1) / LIB_MATH_RANDOM_BLOCK;
+    parallelFor(blocks, 1, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t b = _begin; b < _end; b++)
+        {
+            random_t generator(_seed, b);
+            _func(generator, b * LIB_MATH_RANDOM_BLOCK, std::min(_count, (b + 1) * LIB_MATH_RANDOM_BLOCK));
+        }
+    });
+}
+
+// writes the first _n lanes of up to 4 components
+template<typename V>
+static void randomStore(V *_out, const size_t _n, const uint32 _components, const float32x8 *_lanes)
+{
+    alignas(32) float32 lane[4][8];
+    for (uint32 k = 0; k < _components; k++)
+    {
+        simdStore(lane[k], _lanes[k]);
+    }
+    for (size_t l = 0; l < _n; l++)
+    {
+        for (uint32 k = 0; k < _components; k++)
+        {
+            _out[l][k] = lane[k][l];
+        }
+    }
+}
+
+// unit vectors with z = _z, uniform around the z axis
+static void randomAroundZ(random_t &_r, const float32x8 &_z, float32x8 _v[3])
+{
+    float32x8 s;
+    float32x8 c;
+    randomSinCos(randomNextFloat(_r), s, c);
+    const float32x8 radius = simdSqrt(simdMax(simdSet(1.0f) - (_z * _z), simdSet(0.0f)));
+    _v[0] = radius * c;
+    _v[1] = radius * s;
+    _v[2] = _z;
+}
+
+void randomUniform(const uint64 _seed, float32 *_out, const size_t _count, const float32 _min, const float32 _max)
+{
+    const float32x8 range = simdSet(_max - _min);
+    const float32x8 min   = simdSet(_min);
+    randomBlocks(_seed, _count, [&](random_t &_r, const size_t _begin, const size_t _end)
+    {
+        alignas(32) float32 lane[8];
+        for (size_t i = _begin; i < _end; i += 8)
+        {
+            simdStore(lane, simdMadd(randomNextFloat(_r), range, min));
+            std::copy(lane, lane + std::min<size_t>(8, _end - i), _out + i);
+        }
+    });
+}
+
+void randomDisk(const uint64 _seed, vec2_t<float32> *_out, const size_t _count)
+{
+    randomBlocks(_seed, _count, [&](random_t &_r, const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i += 8)
+        {
+            float32x8 v[2];
+            float32x8 s;
+            float32x8 c;
+            const float32x8 radius = simdSqrt(randomNextFloat(_r));
+            randomSinCos(randomNextFloat(_r), s, c);
+            v[0] = radius * c;
+            v[1] = radius * s;
+            randomStore(_out + i, std::min<size_t>(8, _end - i), 2, v);
+        }
+    });
+}
+
+void randomUnitSphere(const uint64 _seed, vec3_t<float32> *_out, const size_t _count)
+{
+    randomBlocks(_seed, _count, [&](random_t &_r, const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i += 8)
+        {
+            float32x8 v[3];
+            randomAroundZ(_r, simdMadd(randomNextFloat(_r), simdSet(-2.0f), simdSet(1.0f)), v);
+            randomStore(_out + i, std::min<size_t>(8, _end - i), 3, v);
+        }
+    });
+}
+
+void randomInSphere(const uint64 _seed, vec3_t<float32> *_out, const size_t _count)
+{
+    randomBlocks(_seed, _count, [&](random_t &_r, const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i += 8)
+        {
+            float32x8 v[3];
+            randomAroundZ(_r, simdMadd(randomNextFloat(_r), simdSet(-2.0f), simdSet(1.0f)), v);
+            // the largest of three uniforms has density 3 r^2, i.e. the cube root of a uniform
+            const float32x8 radius = simdMax(randomNextFloat(_r), simdMax(randomNextFloat(_r), randomNextFloat(_r)));
+            for (uint32 k = 0; k < 3; k++)
+            {
+                v[k] = v[k] * radius;
+            }
+            randomStore(_out + i, std::min<size_t>(8, _end - i), 3, v);
+        }
+    });
+}
+
+void randomHemisphere(const uint64 _seed, vec3_t<float32> *_out, const size_t _count)
+{
+    randomBlocks(_seed, _count, [&](random_t &_r, const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i += 8)
+        {
+            float32x8 v[3];
+            randomAroundZ(_r, simdSet(1.0f) - randomNextFloat(_r), v);
+            randomStore(_out + i, std::min<size_t>(8, _end - i), 3, v);
+        }
+    });
+}
+
+void randomCosineHemisphere(const uint64 _seed, vec3_t<float32> *_out, const size_t _count)
+{
+    randomBlocks(_seed, _count, [&](random_t &_r, const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i += 8)
+        {
+            // uniform disk projected up onto the hemisphere
+            float32x8 v[3];
+            randomAroundZ(_r, simdSqrt(simdSet(1.0f) - randomNextFloat(_r)), v);
+            randomStore(_out + i, std::min<size_t>(8, _end - i), 3, v);
+        }
+    });
+}
+
+void randomCone(const uint64 _seed, const vec3_t<float32> &_axis, const float32 _angle, vec3_t<float32> *_out, const size_t _count)
+{
+    // branchless orthonormal basis around _axis, Duff et al. 2017
+    const float32 sign = std::copysign(1.0f, _axis.z);
+    const float32 a    = -1.0f / (sign + _axis.z);
+    const float32 b    = _axis.x * _axis.y * a;
+    const vec3_t<float32> tangent(1.0f + (sign * _axis.x * _axis.x * a), sign * b, -sign * _axis.x);
+    const vec3_t<float32> bitangent(b, sign + (_axis.y * _axis.y * a), -_axis.y);
+    const float32x8 spread = simdSet(1.0f - std::cos(_angle));
+    randomBlocks(_seed, _count, [&](random_t &_r, const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i += 8)
+        {
+            float32x8 l[3];
+            float32x8 v[3];
+            randomAroundZ(_r, simdSet(1.0f) - (randomNextFloat(_r) * spread), l);
+            for (uint32 k = 0; k < 3; k++)
+            {
+                v[k] = simdMadd(l[0], simdSet(tangent[k]), simdMadd(l[1], simdSet(bitangent[k]), l[2] * simdSet(_axis[k])));
+            }
+            randomStore(_out + i, std::min<size_t>(8, _end - i), 3, v);
+        }
+    });
+}
+
+void randomRotation(const uint64 _seed, quaternion<float32> *_out, const size_t _count)
+{
+    // Shoemake, uniform over SO(3)
+    randomBlocks(_seed, _count, [&](random_t &_r, const size_t _begin, const size_t _end)
+    {
+        alignas(32) float32 lane[4][8];
+        for (size_t i = _begin; i < _end; i += 8)
+        {
+            const float32x8 u  = randomNextFloat(_r);
+            const float32x8 r1 = simdSqrt(simdSet(1.0f) - u);
+            const float32x8 r2 = simdSqrt(u);
+            float32x8 s1;
+            float32x8 c1;
+            float32x8 s2;
+            float32x8 c2;
+            randomSinCos(randomNextFloat(_r), s1, c1);
+            randomSinCos(randomNextFloat(_r), s2, c2);
+            simdStore(lane[0], r2 * c2);
+            simdStore(lane[1], r1 * s1);
+            simdStore(lane[2], r1 * c1);
+            simdStore(lane[3], r2 * s2);
+            const size_t n = std::min<size_t>(8, _end - i);
+            for (size_t l = 0; l < n; l++)
+            {
+                _out[i + l] = quaternion<float32>(lane[0][l], lane[1][l], lane[2][l], lane[3][l]);
+            }
+        }
+    });
+}
@@ -0,0 +1,126 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_RANDOM_HPP
+#define LIB_MATH_RANDOM_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_quaternion.hpp"
+#include "libMath_simd.hpp"
+#include "libMath_vector.hpp"
+
+#define LIB_MATH_RANDOM_BLOCK 4096 // outputs per independently seeded block
+
+// 8 independent xoshiro128+ generators in uint32x8 lanes, seeded through splitmix64 from a seed
+// and a stream number, so every thread or job can own a reproducible stream.
+// The batch samplers split their output into LIB_MATH_RANDOM_BLOCK sized blocks, block b draws
+// from stream b, so results depend on the seed only and not on the thread count.
+inline uint64 randomSplitMix(uint64 &_x)
+{
+    uint64 z = (_x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+struct random_t
+{
+    uint32x8 s[4];
+
+    random_t(const uint64 _seed = 0, const uint64 _stream = 0)
+    {
+        uint64 a = _seed;
+        uint64 b = _stream ^ 0x6a09e667f3bcc909ull;
+        uint64 x = randomSplitMix(a) ^ randomSplitMix(b);
+        alignas(32) uint32 lane[4][8];
+        for (uint32 l = 0; l < 8; l++)
+        {
+            for (uint32 i = 0; i < 4; i++)
+            {
+                lane[i][l] = static_cast<uint32>(randomSplitMix(x) >> 32);
+            }
+            // the all zero state is a fixed point
+            lane[0][l] = ((lane[0][l] | lane[1][l] | lane[2][l] | lane[3][l]) == 0) ? 1u : lane[0][l];
+        }
+        for (uint32 i = 0; i < 4; i++)
+        {
+            s[i] = simdLoad(lane[i]);
+        }
+    }
+};
+
+inline uint32x8 randomNext(random_t &_r)
+{
+    const uint32x8 result = _r.s[0] + _r.s[3];
+    const uint32x8 t = _r.s[1] << 9;
+    _r.s[2] = _r.s[2] ^ _r.s[0];
+    _r.s[3] = _r.s[3] ^ _r.s[1];
+    _r.s[1] = _r.s[1] ^ _r.s[2];
+    _r.s[0] = _r.s[0] ^ _r.s[3];
+    _r.s[2] = _r.s[2] ^ t;
+    _r.s[3] = (_r.s[3] << 11) | (_r.s[3] >> 21);
+    return result;
+}
+
+// [0, 1) from the upper 24 bits
+inline float32x8 randomNextFloat(random_t &_r)
+{
+    return simdToFloat(randomNext(_r) >> 8) * simdSet(1.0f / 16777216.0f);
+}
+
+// sin / cos of 2 * pi * _u for _u in [0, 1), Taylor polynomials after folding to [-pi / 2, pi / 2]
+inline void randomSinCos(const float32x8 &_u, float32x8 &_s, float32x8 &_c)
+{
+    const float32x8 pi = simdSet(3.14159265f);
+    // a = 2 * pi * _u - pi, so sin / cos of a are negated
+    float32x8 a = (_u - simdSet(0.5f)) * simdSet(6.28318531f);
+    const float32x8 fold = simdGreater(simdAbs(a), simdSet(1.57079633f));
+    a = simdSelect(fold, simdSelect(simdLess(a, simdSet(0.0f)), -pi, pi) - a, a);
+    const float32x8 a2 = a * a;
+    float32x8 s = simdMadd(a2, simdSet(-1.0f / 39916800.0f), simdSet(1.0f / 362880.0f));
+    s = simdMadd(a2, s, simdSet(-1.0f / 5040.0f));
+    s = simdMadd(a2, s, simdSet(1.0f / 120.0f));
+    s = simdMadd(a2, s, simdSet(-1.0f / 6.0f));
+    s = simdMadd(a2, s, simdSet(1.0f));
+    float32x8 c = simdMadd(a2, simdSet(1.0f / 479001600.0f), simdSet(-1.0f / 3628800.0f));
+    c = simdMadd(a2, c, simdSet(1.0f / 40320.0f));
+    c = simdMadd(a2, c, simdSet(-1.0f / 720.0f));
+    c = simdMadd(a2, c, simdSet(1.0f / 24.0f));
+    c = simdMadd(a2, c, simdSet(-0.5f));
+    c = simdMadd(a2, c, simdSet(1.0f));
+    _s = -(s * a);
+    _c = simdSelect(fold, c, -c);
+}
+
+// uniform distributions, multithreaded
+void randomUniform(const uint64 _seed, float32 *_out, const size_t _count, const float32 _min = 0.0f, const float32 _max = 1.0f);
+void randomDisk(const uint64 _seed, vec2_t<float32> *_out, const size_t _count);
+void randomUnitSphere(const uint64 _seed, vec3_t<float32> *_out, const size_t _count);
+void randomInSphere(const uint64 _seed, vec3_t<float32> *_out, const size_t _count);
+void randomHemisphere(const uint64 _seed, vec3_t<float32> *_out, const size_t _count);               // z >= 0
+void randomCosineHemisphere(const uint64 _seed, vec3_t<float32> *_out, const size_t _count);         // z >= 0, pdf cos(theta) / pi
+void randomCone(const uint64 _seed, const vec3_t<float32> &_axis, const float32 _angle, vec3_t<float32> *_out, const size_t _count); // unit _axis, half angle in radians
+void randomRotation(const uint64 _seed, quaternion<float32> *_out, const size_t _count);
+
+#endif // LIB_MATH_RANDOM_HPP
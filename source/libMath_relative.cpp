@@ -0,0 +1,76 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#include "libMath_parallel.hpp"
+#include "libMath_relative.hpp"
+#include "libMath_simd.hpp"
+
+void cameraRelative(const mat4_t<float64> *_world, const size_t _count, const vec3_t<float64> &_origin, mat4_t<float32> *_out)
+{
+    parallelFor(_count, LIB_MATH_RELATIVE_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+#if defined(LIB_MATH_AVX)
+        // the origin only touches column 3 of rows 0 - 2
+        const __m256d origin[3] =
+        {
+            _mm256_set_pd(_origin.x, 0.0, 0.0, 0.0),
+            _mm256_set_pd(_origin.y, 0.0, 0.0, 0.0),
+            _mm256_set_pd(_origin.z, 0.0, 0.0, 0.0)
+        };
+        for (size_t i = _begin; i < _end; i++)
+        {
+            for (uint32 r = 0; r < 3; r++)
+            {
+                _mm_storeu_ps(_out[i].data[r], _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(_world[i].data[r]), origin[r])));
+            }
+            _mm_storeu_ps(_out[i].data[3], _mm256_cvtpd_ps(_mm256_loadu_pd(_world[i].data[3])));
+        }
+#else
+        for (size_t i = _begin; i < _end; i++)
+        {
+            for (uint32 r = 0; r < 4; r++)
+            {
+                for (uint32 c = 0; c < 4; c++)
+                {
+                    _out[i].data[r][c] = static_cast<float32>(_world[i].data[r][c]);
+                }
+            }
+            for (uint32 r = 0; r < 3; r++)
+            {
+                _out[i].data[r][3] = static_cast<float32>(_world[i].data[r][3] - _origin[r]);
+            }
+        }
+#endif // LIB_MATH_AVX
+    });
+}
+
+void cameraRelative(const vec3_t<float64> *_world, const size_t _count, const vec3_t<float64> &_origin, vec3_t<float32> *_out)
+{
+    parallelFor(_count, LIB_MATH_RELATIVE_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            _out[i] = vec3_t<float32>(static_cast<float32>(_world[i].x - _origin.x), static_cast<float32>(_world[i].y - _origin.y), static_cast<float32>(_world[i].z - _origin.z));
+        }
+    });
+}
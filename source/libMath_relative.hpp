@@ -0,0 +1,42 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_RELATIVE_HPP
+#define LIB_MATH_RELATIVE_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_matrix.hpp"
+#include "libMath_vector.hpp"
+
+#define LIB_MATH_RELATIVE_GRAIN 8192 // minimum instances per thread
+
+// Camera relative rendering for float64 worlds: the camera origin is subtracted from the
+// translation in float64 before the result is rounded to float32, so the float32 error depends on
+// the distance to the camera, not on the distance to the world origin. The rotation / scale part
+// and the bottom row are rounded as they are. Rows are converted 4 doubles at a time with AVX.
+
+void cameraRelative(const mat4_t<float64> *_world, const size_t _count, const vec3_t<float64> &_origin, mat4_t<float32> *_out);
+void cameraRelative(const vec3_t<float64> *_world, const size_t _count, const vec3_t<float64> &_origin, vec3_t<float32> *_out);
+
+#endif // LIB_MATH_RELATIVE_HPP
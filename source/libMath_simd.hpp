@@ -0,0 +1,326 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_SIMD_HPP
+#define LIB_MATH_SIMD_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+
+#include <cstring>
+
+// Instruction sets follow the compiler flags (-msse4.1, -mavx2, -mfma, -march=native ...),
+// every kernel keeps a scalar path for other targets.
+#if defined(__SSE2__) || defined(_M_X64)
+    #define LIB_MATH_SSE 1
+    #include <immintrin.h>
+#endif
+#if defined(__AVX__)
+    #define LIB_MATH_AVX 1
+#endif
+#if defined(__AVX2__)
+    #define LIB_MATH_AVX2 1
+#endif
+#if defined(__FMA__)
+    #define LIB_MATH_FMA 1
+#endif
+#if defined(__BMI2__)
+    #define LIB_MATH_BMI2 1
+#endif
+
+#if defined(LIB_MATH_SSE)
+// _a * _b + _c
+inline __m128 simdMadd(const __m128 _a, const __m128 _b, const __m128 _c)
+{
+#if defined(LIB_MATH_FMA)
+    return _mm_fmadd_ps(_a, _b, _c);
+#else
+    return _mm_add_ps(_mm_mul_ps(_a, _b), _c);
+#endif
+}
+
+// (dot(_r0, _v), dot(_r1, _v), dot(_r2, _v), dot(_r3, _v))
+inline __m128 simdDot4x4(__m128 _r0, __m128 _r1, __m128 _r2, __m128 _r3, const __m128 _v)
+{
+    _r0 = _mm_mul_ps(_r0, _v);
+    _r1 = _mm_mul_ps(_r1, _v);
+    _r2 = _mm_mul_ps(_r2, _v);
+    _r3 = _mm_mul_ps(_r3, _v);
+    _MM_TRANSPOSE4_PS(_r0, _r1, _r2, _r3);
+    return _mm_add_ps(_mm_add_ps(_r0, _r1), _mm_add_ps(_r2, _r3));
+}
+#endif // LIB_MATH_SSE
+
+#if defined(LIB_MATH_AVX)
+inline __m256 simdMadd(const __m256 _a, const __m256 _b, const __m256 _c)
+{
+#if defined(LIB_MATH_FMA)
+    return _mm256_fmadd_ps(_a, _b, _c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(_a, _b), _c);
+#endif
+}
+#endif // LIB_MATH_AVX
+
+// 8 float32 lanes, AVX register or a plain array the compiler can vectorize.
+// Comparisons return lane masks (all bits set or clear) for simdSelect() and the bit operations.
+struct float32x8
+{
+#if defined(LIB_MATH_AVX)
+    __m256 v;
+#else
+    float32 v[8];
+#endif
+};
+
+#if defined(LIB_MATH_AVX)
+inline float32x8 simdSet(const float32 _f) { return { _mm256_set1_ps(_f) }; }
+inline float32x8 simdLoad(const float32 *_p) { return { _mm256_loadu_ps(_p) }; }
+inline void simdStore(float32 *_p, const float32x8 &_a) { _mm256_storeu_ps(_p, _a.v); }
+inline float32x8 operator+(const float32x8 &_a, const float32x8 &_b) { return { _mm256_add_ps(_a.v, _b.v) }; }
+inline float32x8 operator-(const float32x8 &_a, const float32x8 &_b) { return { _mm256_sub_ps(_a.v, _b.v) }; }
+inline float32x8 operator*(const float32x8 &_a, const float32x8 &_b) { return { _mm256_mul_ps(_a.v, _b.v) }; }
+inline float32x8 operator/(const float32x8 &_a, const float32x8 &_b) { return { _mm256_div_ps(_a.v, _b.v) }; }
+inline float32x8 operator-(const float32x8 &_a) { return { _mm256_xor_ps(_a.v, _mm256_set1_ps(-0.0f)) }; }
+inline float32x8 simdMadd(const float32x8 &_a, const float32x8 &_b, const float32x8 &_c) { return { simdMadd(_a.v, _b.v, _c.v) }; }
+inline float32x8 simdMin(const float32x8 &_a, const float32x8 &_b) { return { _mm256_min_ps(_a.v, _b.v) }; }
+inline float32x8 simdMax(const float32x8 &_a, const float32x8 &_b) { return { _mm256_max_ps(_a.v, _b.v) }; }
+inline float32x8 simdAbs(const float32x8 &_a) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _a.v) }; }
+inline float32x8 simdSqrt(const float32x8 &_a) { return { _mm256_sqrt_ps(_a.v) }; }
+inline float32x8 simdFloor(const float32x8 &_a) { return { _mm256_floor_ps(_a.v) }; }
+inline float32x8 simdLess(const float32x8 &_a, const float32x8 &_b) { return { _mm256_cmp_ps(_a.v, _b.v, _CMP_LT_OQ) }; }
+inline float32x8 simdLessEqual(const float32x8 &_a, const float32x8 &_b) { return { _mm256_cmp_ps(_a.v, _b.v, _CMP_LE_OQ) }; }
+inline float32x8 simdGreater(const float32x8 &_a, const float32x8 &_b) { return { _mm256_cmp_ps(_a.v, _b.v, _CMP_GT_OQ) }; }
+inline float32x8 simdAnd(const float32x8 &_a, const float32x8 &_b) { return { _mm256_and_ps(_a.v, _b.v) }; }
+inline float32x8 simdOr(const float32x8 &_a, const float32x8 &_b) { return { _mm256_or_ps(_a.v, _b.v) }; }
+inline float32x8 simdXor(const float32x8 &_a, const float32x8 &_b) { return { _mm256_xor_ps(_a.v, _b.v) }; }
+inline float32x8 simdSelect(const float32x8 &_mask, const float32x8 &_a, const float32x8 &_b) { return { _mm256_blendv_ps(_b.v, _a.v, _mask.v) }; }
+inline uint32 simdMaskBits(const float32x8 &_mask) { return static_cast<uint32>(_mm256_movemask_ps(_mask.v)); }
+// 1/sqrt estimate and one Newton-Raphson step, see rsqrt()
+inline float32x8 simdRsqrt(const float32x8 &_a) { const __m256 y = _mm256_rsqrt_ps(_a.v); return { _mm256_mul_ps(y, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), _a.v), _mm256_mul_ps(y, y)))) }; }
+#else
+inline float32 simdLaneMask(const bool _b) { const uint32 bits = _b ? 0xffffffffu : 0u; float32 f; std::memcpy(&f, &bits, sizeof(f)); return f; }
+inline uint32 simdLaneBits(const float32 _f) { uint32 bits; std::memcpy(&bits, &_f, sizeof(bits)); return bits; }
+inline float32 simdLaneFloat(const uint32 _bits) { float32 f; std::memcpy(&f, &_bits, sizeof(f)); return f; }
+inline float32x8 simdSet(const float32 _f) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _f; return r; }
+inline float32x8 simdLoad(const float32 *_p) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _p[i]; return r; }
+inline void simdStore(float32 *_p, const float32x8 &_a) { for (uint32 i = 0; i < 8; i++) _p[i] = _a.v[i]; }
+inline float32x8 operator+(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] + _b.v[i]; return r; }
+inline float32x8 operator-(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] - _b.v[i]; return r; }
+inline float32x8 operator*(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] * _b.v[i]; return r; }
+inline float32x8 operator/(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] / _b.v[i]; return r; }
+inline float32x8 operator-(const float32x8 &_a) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = -_a.v[i]; return r; }
+inline float32x8 simdMadd(const float32x8 &_a, const float32x8 &_b, const float32x8 &_c) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = (_a.v[i] * _b.v[i]) + _c.v[i]; return r; }
+inline float32x8 simdMin(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = (_a.v[i] < _b.v[i]) ? _a.v[i] : _b.v[i]; return r; }
+inline float32x8 simdMax(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = (_a.v[i] > _b.v[i]) ? _a.v[i] : _b.v[i]; return r; }
+inline float32x8 simdAbs(const float32x8 &_a) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = std::fabs(_a.v[i]); return r; }
+inline float32x8 simdSqrt(const float32x8 &_a) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = std::sqrt(_a.v[i]); return r; }
+inline float32x8 simdFloor(const float32x8 &_a) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = std::floor(_a.v[i]); return r; }
+inline float32x8 simdLess(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = simdLaneMask(_a.v[i] < _b.v[i]); return r; }
+inline float32x8 simdLessEqual(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = simdLaneMask(_a.v[i] <= _b.v[i]); return r; }
+inline float32x8 simdGreater(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = simdLaneMask(_a.v[i] > _b.v[i]); return r; }
+inline float32x8 simdAnd(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = simdLaneFloat(simdLaneBits(_a.v[i]) & simdLaneBits(_b.v[i])); return r; }
+inline float32x8 simdOr(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = simdLaneFloat(simdLaneBits(_a.v[i]) | simdLaneBits(_b.v[i])); return r; }
+inline float32x8 simdXor(const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = simdLaneFloat(simdLaneBits(_a.v[i]) ^ simdLaneBits(_b.v[i])); return r; }
+inline float32x8 simdSelect(const float32x8 &_mask, const float32x8 &_a, const float32x8 &_b) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = (simdLaneBits(_mask.v[i]) >> 31) ? _a.v[i] : _b.v[i]; return r; }
+inline uint32 simdMaskBits(const float32x8 &_mask) { uint32 bits = 0; for (uint32 i = 0; i < 8; i++) bits |= (simdLaneBits(_mask.v[i]) >> 31) << i; return bits; }
+inline float32x8 simdRsqrt(const float32x8 &_a) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = 1.0f / std::sqrt(_a.v[i]); return r; }
+#endif // LIB_MATH_AVX
+
+// swaps the masked lanes of _a and _b
+inline void simdSwap(float32x8 &_a, float32x8 &_b, const float32x8 &_mask) { const float32x8 t = simdSelect(_mask, _b, _a); _b = simdSelect(_mask, _a, _b); _a = t; }
+
+// 8 uint32 lanes with wrapping arithmetic, for hashing and bit manipulation. simdToFloat() and
+// simdToInt() convert through int32 (truncating), simdTestBits() returns a float32x8 lane mask.
+struct uint32x8
+{
+#if defined(LIB_MATH_AVX2)
+    __m256i v;
+#else
+    uint32 v[8];
+#endif
+};
+
+#if defined(LIB_MATH_AVX2)
+inline uint32x8 simdSet(const uint32 _u) { return { _mm256_set1_epi32(static_cast<int32>(_u)) }; }
+inline uint32x8 simdLoad(const uint32 *_p) { return { _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_p)) }; }
+inline void simdStore(uint32 *_p, const uint32x8 &_a) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(_p), _a.v); }
+inline uint32x8 operator+(const uint32x8 &_a, const uint32x8 &_b) { return { _mm256_add_epi32(_a.v, _b.v) }; }
+inline uint32x8 operator-(const uint32x8 &_a, const uint32x8 &_b) { return { _mm256_sub_epi32(_a.v, _b.v) }; }
+inline uint32x8 operator*(const uint32x8 &_a, const uint32x8 &_b) { return { _mm256_mullo_epi32(_a.v, _b.v) }; }
+inline uint32x8 operator^(const uint32x8 &_a, const uint32x8 &_b) { return { _mm256_xor_si256(_a.v, _b.v) }; }
+inline uint32x8 operator&(const uint32x8 &_a, const uint32x8 &_b) { return { _mm256_and_si256(_a.v, _b.v) }; }
+inline uint32x8 operator|(const uint32x8 &_a, const uint32x8 &_b) { return { _mm256_or_si256(_a.v, _b.v) }; }
+inline uint32x8 operator>>(const uint32x8 &_a, const uint32 _n) { return { _mm256_srl_epi32(_a.v, _mm_cvtsi32_si128(static_cast<int32>(_n))) }; }
+inline uint32x8 operator<<(const uint32x8 &_a, const uint32 _n) { return { _mm256_sll_epi32(_a.v, _mm_cvtsi32_si128(static_cast<int32>(_n))) }; }
+inline float32x8 simdToFloat(const uint32x8 &_a) { return { _mm256_cvtepi32_ps(_a.v) }; }
+inline uint32x8 simdToInt(const float32x8 &_a) { return { _mm256_cvttps_epi32(_a.v) }; }
+inline float32x8 simdTestBits(const uint32x8 &_a, const uint32 _bits) { return { _mm256_castsi256_ps(_mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_and_si256(_a.v, _mm256_set1_epi32(static_cast<int32>(_bits))), _mm256_setzero_si256()), _mm256_set1_epi32(-1))) }; }
+#else
+inline uint32x8 simdSet(const uint32 _u) { uint32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _u; return r; }
+inline uint32x8 simdLoad(const uint32 *_p) { uint32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _p[i]; return r; }
+inline void simdStore(uint32 *_p, const uint32x8 &_a) { for (uint32 i = 0; i < 8; i++) _p[i] = _a.v[i]; }
+inline uint32x8 operator+(const uint32x8 &_a, const uint32x8 &_b) { uint32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] + _b.v[i]; return r; }
+inline uint32x8 operator-(const uint32x8 &_a, const uint32x8 &_b) { uint32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] - _b.v[i]; return r; }
+inline uint32x8 operator*(const uint32x8 &_a, const uint32x8 &_b) { uint32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] * _b.v[i]; return r; }
+inline uint32x8 operator^(const uint32x8 &_a, const uint32x8 &_b) { uint32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] ^ _b.v[i]; return r; }
+inline uint32x8 operator&(const uint32x8 &_a, const uint32x8 &_b) { uint32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] & _b.v[i]; return r; }
+inline uint32x8 operator|(const uint32x8 &_a, const uint32x8 &_b) { uint32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] | _b.v[i]; return r; }
+inline uint32x8 operator>>(const uint32x8 &_a, const uint32 _n) { uint32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] >> _n; return r; }
+inline uint32x8 operator<<(const uint32x8 &_a, const uint32 _n) { uint32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = _a.v[i] << _n; return r; }
+#if defined(LIB_MATH_AVX)
+inline float32x8 simdToFloat(const uint32x8 &_a) { return { _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(_a.v))) }; }
+inline uint32x8 simdToInt(const float32x8 &_a) { uint32x8 r; _mm256_storeu_si256(reinterpret_cast<__m256i *>(r.v), _mm256_cvttps_epi32(_a.v)); return r; }
+inline float32x8 simdTestBits(const uint32x8 &_a, const uint32 _bits) { uint32x8 m; for (uint32 i = 0; i < 8; i++) m.v[i] = ((_a.v[i] & _bits) != 0) ? 0xffffffffu : 0u; return { _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(m.v))) }; }
+#else
+inline float32x8 simdToFloat(const uint32x8 &_a) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = static_cast<float32>(static_cast<int32>(_a.v[i])); return r; }
+inline uint32x8 simdToInt(const float32x8 &_a) { uint32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = static_cast<uint32>(static_cast<int32>(_a.v[i])); return r; }
+inline float32x8 simdTestBits(const uint32x8 &_a, const uint32 _bits) { float32x8 r; for (uint32 i = 0; i < 8; i++) r.v[i] = simdLaneMask((_a.v[i] & _bits) != 0); return r; }
+#endif // LIB_MATH_AVX
+#endif // LIB_MATH_AVX2
+
+// scalar lanes, lets a kernel be written once for float32 / float64 and float32x8
+template<typename L> inline L simdSplat(const float64 _f) { return static_cast<L>(_f); }
+template<> inline float32x8 simdSplat<float32x8>(const float64 _f) { return simdSet(static_cast<float32>(_f)); }
+template<typename I> inline I simdSplatInt(const uint32 _u) { return static_cast<I>(_u); }
+template<> inline uint32x8 simdSplatInt<uint32x8>(const uint32 _u) { return simdSet(_u); }
+inline float32 simdToFloat(const uint32 _a) { return static_cast<float32>(static_cast<int32>(_a)); }
+inline uint32 simdToInt(const float32 _a) { return static_cast<uint32>(static_cast<int32>(_a)); }
+inline bool simdTestBits(const uint32 _a, const uint32 _bits) { return (_a & _bits) != 0; }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline T simdMadd(const T _a, const T _b, const T _c) { return (_a * _b) + _c; }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline T simdMin(const T _a, const T _b) { return (_a < _b) ? _a : _b; }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline T simdMax(const T _a, const T _b) { return (_a > _b) ? _a : _b; }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline T simdAbs(const T _a) { return std::fabs(_a); }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline T simdSqrt(const T _a) { return std::sqrt(_a); }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline T simdRsqrt(const T _a) { return static_cast<T>(1.0) / std::sqrt(_a); }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline T simdFloor(const T _a) { return std::floor(_a); }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline bool simdLess(const T _a, const T _b) { return _a < _b; }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline bool simdLessEqual(const T _a, const T _b) { return _a <= _b; }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline bool simdGreater(const T _a, const T _b) { return _a > _b; }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline T simdSelect(const bool _mask, const T _a, const T _b) { return _mask ? _a : _b; }
+inline bool simdAnd(const bool _a, const bool _b) { return _a && _b; }
+inline bool simdOr(const bool _a, const bool _b) { return _a || _b; }
+template<typename T, typename = typename std::enable_if<std::is_floating_point<T>::value>::type> inline void simdSwap(T &_a, T &_b, const bool _mask) { const T t = _mask ? _b : _a; _b = _mask ? _a : _b; _a = t; }
+
+// lane group starting at _p[_i], a single value for scalar lanes
+template<typename L, typename T>
+inline L simdLoadAt(const T *_p, const size_t _i)
+{
+    if constexpr (std::is_same<L, T>::value)
+    {
+        return _p[_i];
+    }
+    else
+    {
+        return simdLoad(_p + _i);
+    }
+}
+
+template<typename L, typename T>
+inline void simdStoreAt(T *_p, const size_t _i, const L &_v)
+{
+    if constexpr (std::is_same<L, T>::value)
+    {
+        _p[_i] = _v;
+    }
+    else
+    {
+        simdStore(_p + _i, _v);
+    }
+}
+
+// array of structures (vec2_t / vec3_t / vec4_t ...) to one lane group per component and back
+template<typename L, typename V>
+inline void simdLoadVec(const V *_p, const size_t _i, L _out[V::SIZE])
+{
+    if constexpr (std::is_same<L, float32x8>::value)
+    {
+        alignas(32) float32 lane[V::SIZE][8];
+        for (uint32 l = 0; l < 8; l++)
+        {
+            for (uint32 k = 0; k < V::SIZE; k++)
+            {
+                lane[k][l] = _p[_i + l][k];
+            }
+        }
+        for (uint32 k = 0; k < V::SIZE; k++)
+        {
+            _out[k] = simdLoad(lane[k]);
+        }
+    }
+    else
+    {
+        for (uint32 k = 0; k < V::SIZE; k++)
+        {
+            _out[k] = _p[_i][k];
+        }
+    }
+}
+
+template<typename L, typename V>
+inline void simdStoreVec(V *_p, const size_t _i, const L _in[V::SIZE])
+{
+    if constexpr (std::is_same<L, float32x8>::value)
+    {
+        alignas(32) float32 lane[V::SIZE][8];
+        for (uint32 k = 0; k < V::SIZE; k++)
+        {
+            simdStore(lane[k], _in[k]);
+        }
+        for (uint32 l = 0; l < 8; l++)
+        {
+            for (uint32 k = 0; k < V::SIZE; k++)
+            {
+                _p[_i + l][k] = lane[k][l];
+            }
+        }
+    }
+    else
+    {
+        for (uint32 k = 0; k < V::SIZE; k++)
+        {
+            _p[_i][k] = _in[k];
+        }
+    }
+}
+
+// _func(lane, index) over [_begin, _end), write it as a generic lambda: float32 spans run full
+// groups of 8 with a float32x8 lane tag, the remainder and other types one T at a time
+template<typename T, typename F>
+inline void simdForLanes(const size_t _begin, const size_t _end, F &&_func)
+{
+    size_t i = _begin;
+    if constexpr (std::is_same<T, float32>::value)
+    {
+        for (; (i + 8) <= _end; i += 8)
+        {
+            _func(float32x8{}, i);
+        }
+    }
+    for (; i < _end; i++)
+    {
+        _func(T{}, i);
+    }
+}
+
+#endif // LIB_MATH_SIMD_HPP
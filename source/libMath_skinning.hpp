@@ -0,0 +1,295 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_SKINNING_HPP
+#define LIB_MATH_SKINNING_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_instrument.hpp"
+#include "libMath_matrix.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_quaternion.hpp"
+#include "libMath_simd.hpp"
+#include "libMath_vector.hpp"
+
+#define LIB_MATH_SKIN_INFLUENCES 4    // bone influences per vertex
+#define LIB_MATH_SKIN_GRAIN      4096 // minimum vertices per thread
+
+// Linear blend skinning, vertex i reads _boneIndices[i * 4 + k] and _boneWeights[i * 4 + k].
+// Unused influences need a valid index and a weight of 0, weights are expected to sum to 1.
+// The bone matrices are blended per vertex (affine rows only) and applied once to the position
+// and the normal. Normals are renormalized, _normals / _outNormals may be nullptr.
+// vec4_t streams keep their w, positions are transformed with it.
+
+// vertex stream helpers
+template<typename T> inline void skinLoad(const vec3_t<T> &_v, const T _w, T _out[4]) { _out[0] = _v.x; _out[1] = _v.y; _out[2] = _v.z; _out[3] = _w; }
+template<typename T> inline void skinLoad(const vec4_t<T> &_v, const T _w, T _out[4]) { _out[0] = _v.x; _out[1] = _v.y; _out[2] = _v.z; _out[3] = (_w != 0) ? _v.w : 0; }
+template<typename T> inline void skinStore(vec3_t<T> &_v, const vec3_t<T> &, const T _out[3]) { _v.x = _out[0]; _v.y = _out[1]; _v.z = _out[2]; }
+template<typename T> inline void skinStore(vec4_t<T> &_v, const vec4_t<T> &_in, const T _out[3]) { _v.x = _out[0]; _v.y = _out[1]; _v.z = _out[2]; _v.w = _in.w; }
+
+template<typename T>
+inline void skinNormalize(T _v[3])
+{
+    const T l = std::sqrt((_v[0] * _v[0]) + (_v[1] * _v[1]) + (_v[2] * _v[2]));
+    if (l > 0.0)
+    {
+        const T il = 1.0 / l;
+        _v[0] *= il;
+        _v[1] *= il;
+        _v[2] *= il;
+    }
+}
+
+template<typename T, typename V>
+void skinLinearRange(const mat4_t<T> *_bones, const uint16 *_boneIndices, const T *_boneWeights, const V *_positions, const V *_normals, V *_outPositions, V *_outNormals, const size_t _begin, const size_t _end)
+{
+    for (size_t i = _begin; i < _end; i++)
+    {
+        T rows[3][4] = {};
+        for (uint32 k = 0; k < LIB_MATH_SKIN_INFLUENCES; k++)
+        {
+            const mat4_t<T> &bone = _bones[_boneIndices[(i * LIB_MATH_SKIN_INFLUENCES) + k]];
+            const T weight = _boneWeights[(i * LIB_MATH_SKIN_INFLUENCES) + k];
+            for (uint32 r = 0; r < 3; r++)
+            {
+                for (uint32 c = 0; c < 4; c++)
+                {
+                    rows[r][c] += bone.data[r][c] * weight;
+                }
+            }
+        }
+
+        T v[4];
+        T o[3];
+        skinLoad(_positions[i], static_cast<T>(1), v);
+        for (uint32 r = 0; r < 3; r++)
+        {
+            o[r] = (rows[r][0] * v[0]) + (rows[r][1] * v[1]) + (rows[r][2] * v[2]) + (rows[r][3] * v[3]);
+        }
+        skinStore(_outPositions[i], _positions[i], o);
+
+        if (_normals != nullptr)
+        {
+            skinLoad(_normals[i], static_cast<T>(0), v);
+            for (uint32 r = 0; r < 3; r++)
+            {
+                o[r] = (rows[r][0] * v[0]) + (rows[r][1] * v[1]) + (rows[r][2] * v[2]);
+            }
+            skinNormalize(o);
+            skinStore(_outNormals[i], _normals[i], o);
+        }
+    }
+}
+
+#if defined(LIB_MATH_SSE)
+template<typename V>
+void skinLinearRange(const mat4_t<float32> *_bones, const uint16 *_boneIndices, const float32 *_boneWeights, const V *_positions, const V *_normals, V *_outPositions, V *_outNormals, const size_t _begin, const size_t _end)
+{
+    alignas(16) float32 v[4];
+    alignas(16) float32 o[4];
+    const __m128 r3 = _mm_setzero_ps();
+    for (size_t i = _begin; i < _end; i++)
+    {
+        const uint16  *index  = _boneIndices + (i * LIB_MATH_SKIN_INFLUENCES);
+        const float32 *weight = _boneWeights + (i * LIB_MATH_SKIN_INFLUENCES);
+
+        const float32 *bone = &_bones[index[0]].data[0][0];
+        __m128 w  = _mm_set1_ps(weight[0]);
+        __m128 r0 = _mm_mul_ps(_mm_loadu_ps(bone + 0), w);
+        __m128 r1 = _mm_mul_ps(_mm_loadu_ps(bone + 4), w);
+        __m128 r2 = _mm_mul_ps(_mm_loadu_ps(bone + 8), w);
+        for (uint32 k = 1; k < LIB_MATH_SKIN_INFLUENCES; k++)
+        {
+            bone = &_bones[index[k]].data[0][0];
+            w  = _mm_set1_ps(weight[k]);
+            r0 = simdMadd(_mm_loadu_ps(bone + 0), w, r0);
+            r1 = simdMadd(_mm_loadu_ps(bone + 4), w, r1);
+            r2 = simdMadd(_mm_loadu_ps(bone + 8), w, r2);
+        }
+
+        skinLoad(_positions[i], 1.0f, v);
+        _mm_store_ps(o, simdDot4x4(r0, r1, r2, r3, _mm_load_ps(v)));
+        skinStore(_outPositions[i], _positions[i], o);
+
+        if (_normals != nullptr)
+        {
+            skinLoad(_normals[i], 0.0f, v);
+            _mm_store_ps(o, simdDot4x4(r0, r1, r2, r3, _mm_load_ps(v)));
+            skinNormalize(o);
+            skinStore(_outNormals[i], _normals[i], o);
+        }
+    }
+}
+#endif // LIB_MATH_SSE
+
+template<typename T, typename V>
+void skinLinear(const mat4_t<T> *_bones, const uint16 *_boneIndices, const T *_boneWeights, const V *_positions, const V *_normals, V *_outPositions, V *_outNormals, const size_t _count)
+{
+    LIB_MATH_INSTRUMENT_SCOPE(INSTRUMENT_SKIN_LINEAR, _count);
+    parallelFor(_count, LIB_MATH_SKIN_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        skinLinearRange(_bones, _boneIndices, _boneWeights, _positions, _normals, _outPositions, _outNormals, _begin, _end);
+    });
+}
+
+// Dual quaternion skinning, same vertex layout as skinLinear(). The 8 float bone palette is blended
+// with antipodality correction against the first influence and renormalized, which avoids the
+// volume loss ("candy wrapper") of linear blending. Bones are expected to be rigid.
+template<typename T>
+inline void skinDualQuaternionApply(const T _b[8], const T _p[3], const T _n[3], T _outP[3], T _outN[3], const bool _normal)
+{
+    const T l  = std::sqrt((_b[0] * _b[0]) + (_b[1] * _b[1]) + (_b[2] * _b[2]) + (_b[3] * _b[3]));
+    const T il = (l > 0.0) ? (1.0 / l) : 0.0;
+    const quaternion<T> r(_b[0] * il, _b[1] * il, _b[2] * il, _b[3] * il);
+    const quaternion<T> d(_b[4] * il, _b[5] * il, _b[6] * il, _b[7] * il);
+    const dualQuaternion<T> dq(r, d);
+    const vec3_t<T> p = dq.transformPoint(vec3_t<T>(_p[0], _p[1], _p[2]));
+    _outP[0] = p.x;
+    _outP[1] = p.y;
+    _outP[2] = p.z;
+    if (_normal)
+    {
+        const vec3_t<T> n = r.rotate(vec3_t<T>(_n[0], _n[1], _n[2]));
+        _outN[0] = n.x;
+        _outN[1] = n.y;
+        _outN[2] = n.z;
+    }
+}
+
+template<typename T, typename V>
+void skinDualQuaternionRange(const dualQuaternion<T> *_bones, const uint16 *_boneIndices, const T *_boneWeights, const V *_positions, const V *_normals, V *_outPositions, V *_outNormals, const size_t _begin, const size_t _end)
+{
+    T p[4];
+    T n[4];
+    T o[3];
+    T on[3];
+    for (size_t i = _begin; i < _end; i++)
+    {
+        const uint16 *index  = _boneIndices + (i * LIB_MATH_SKIN_INFLUENCES);
+        const T      *weight = _boneWeights + (i * LIB_MATH_SKIN_INFLUENCES);
+        const quaternion<T> &pivot = _bones[index[0]].real;
+        T b[8] = {};
+        for (uint32 k = 0; k < LIB_MATH_SKIN_INFLUENCES; k++)
+        {
+            const dualQuaternion<T> &bone = _bones[index[k]];
+            const T w = (pivot.dot(bone.real) < 0.0) ? -weight[k] : weight[k];
+            for (uint32 j = 0; j < 4; j++)
+            {
+                b[j]     += bone.real.array[j] * w;
+                b[j + 4] += bone.dual.array[j] * w;
+            }
+        }
+        skinLoad(_positions[i], static_cast<T>(1), p);
+        if (_normals != nullptr)
+        {
+            skinLoad(_normals[i], static_cast<T>(0), n);
+        }
+        skinDualQuaternionApply(b, p, n, o, on, _normals != nullptr);
+        skinStore(_outPositions[i], _positions[i], o);
+        if (_normals != nullptr)
+        {
+            skinStore(_outNormals[i], _normals[i], on);
+        }
+    }
+}
+
+#if defined(LIB_MATH_SSE)
+template<typename V>
+void skinDualQuaternionRange(const dualQuaternion<float32> *_bones, const uint16 *_boneIndices, const float32 *_boneWeights, const V *_positions, const V *_normals, V *_outPositions, V *_outNormals, const size_t _begin, const size_t _end)
+{
+    static_assert(sizeof(dualQuaternion<float32>) == 8 * sizeof(float32), "dualQuaternion must be 8 packed floats");
+    alignas(32) float32 b[8];
+    float32 p[4];
+    float32 n[4];
+    float32 o[3];
+    float32 on[3];
+    for (size_t i = _begin; i < _end; i++)
+    {
+        const uint16  *index  = _boneIndices + (i * LIB_MATH_SKIN_INFLUENCES);
+        const float32 *weight = _boneWeights + (i * LIB_MATH_SKIN_INFLUENCES);
+        const float32 *pivot  = &_bones[index[0]].real.array[0];
+        const __m128   pivotReal = _mm_loadu_ps(pivot);
+#if defined(LIB_MATH_AVX)
+        __m256 acc = _mm256_setzero_ps();
+#else
+        __m128 accReal = _mm_setzero_ps();
+        __m128 accDual = _mm_setzero_ps();
+#endif
+        for (uint32 k = 0; k < LIB_MATH_SKIN_INFLUENCES; k++)
+        {
+            const float32 *bone = &_bones[index[k]].real.array[0];
+            const __m128 real = _mm_loadu_ps(bone);
+            __m128 d = _mm_mul_ps(real, pivotReal);
+            d = _mm_add_ps(d, _mm_movehl_ps(d, d));
+            d = _mm_add_ss(d, _mm_shuffle_ps(d, d, 1));
+            const float32 w = (_mm_cvtss_f32(d) < 0.0f) ? -weight[k] : weight[k];
+#if defined(LIB_MATH_AVX)
+            acc = simdMadd(_mm256_loadu_ps(bone), _mm256_set1_ps(w), acc);
+#else
+            accReal = simdMadd(real, _mm_set1_ps(w), accReal);
+            accDual = simdMadd(_mm_loadu_ps(bone + 4), _mm_set1_ps(w), accDual);
+#endif
+        }
+#if defined(LIB_MATH_AVX)
+        _mm256_store_ps(b, acc);
+#else
+        _mm_store_ps(b, accReal);
+        _mm_store_ps(b + 4, accDual);
+#endif
+        skinLoad(_positions[i], 1.0f, p);
+        if (_normals != nullptr)
+        {
+            skinLoad(_normals[i], 0.0f, n);
+        }
+        skinDualQuaternionApply(b, p, n, o, on, _normals != nullptr);
+        skinStore(_outPositions[i], _positions[i], o);
+        if (_normals != nullptr)
+        {
+            skinStore(_outNormals[i], _normals[i], on);
+        }
+    }
+}
+#endif // LIB_MATH_SSE
+
+template<typename T, typename V>
+void skinDualQuaternion(const dualQuaternion<T> *_bones, const uint16 *_boneIndices, const T *_boneWeights, const V *_positions, const V *_normals, V *_outPositions, V *_outNormals, const size_t _count)
+{
+    LIB_MATH_INSTRUMENT_SCOPE(INSTRUMENT_SKIN_DUAL_QUATERNION, _count);
+    parallelFor(_count, LIB_MATH_SKIN_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        skinDualQuaternionRange(_bones, _boneIndices, _boneWeights, _positions, _normals, _outPositions, _outNormals, _begin, _end);
+    });
+}
+
+// palette conversion, bones must be rigid
+template<typename T>
+void dualQuaternionFromMat4(const mat4_t<T> *_in, dualQuaternion<T> *_out, const size_t _count)
+{
+    for (size_t i = 0; i < _count; i++)
+    {
+        _out[i] = dualQuaternion<T>::fromMat4(_in[i]);
+    }
+}
+
+#endif // LIB_MATH_SKINNING_HPP
@@ -0,0 +1,386 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_SOLVE_HPP
+#define LIB_MATH_SOLVE_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_matrix.hpp"
+#include "libMath_simd.hpp"
+#include "libMath_vector.hpp"
+
+#include <limits>
+
+// Direct solvers for A x = b on mat2_t / mat3_t / mat4_t, cheaper and more stable than inverse() * b.
+// luDecompose() / choleskyDecompose() factor in place and return false for singular / non positive
+// definite matrices. The batch versions solve independent systems, float32 runs 8 systems per
+// float32x8 lane set, failed systems write a zero vector.
+
+template<typename M> struct solveTraits { typedef typename std::remove_cv<typename std::remove_extent<decltype(M::array)>::type>::type type; };
+
+// LU with partial pivoting, _m holds the unit lower L below the diagonal and U on and above it
+template<typename M>
+bool luDecompose(M &_m, uint32 _pivot[])
+{
+    typedef typename solveTraits<M>::type T;
+    const uint32 N = M::ROWS;
+    for (uint32 i = 0; i < N; i++)
+    {
+        _pivot[i] = i;
+    }
+    for (uint32 k = 0; k < N; k++)
+    {
+        uint32 p = k;
+        for (uint32 r = k + 1; r < N; r++)
+        {
+            if (std::fabs(_m.data[r][k]) > std::fabs(_m.data[p][k]))
+            {
+                p = r;
+            }
+        }
+        if (std::fabs(_m.data[p][k]) <= std::numeric_limits<T>::min())
+        {
+            return false;
+        }
+        if (p != k)
+        {
+            for (uint32 c = 0; c < N; c++)
+            {
+                const T t = _m.data[k][c];
+                _m.data[k][c] = _m.data[p][c];
+                _m.data[p][c] = t;
+            }
+            const uint32 t = _pivot[k];
+            _pivot[k] = _pivot[p];
+            _pivot[p] = t;
+        }
+        const T inv = 1.0 / _m.data[k][k];
+        for (uint32 r = k + 1; r < N; r++)
+        {
+            const T f = _m.data[r][k] * inv;
+            _m.data[r][k] = f;
+            for (uint32 c = k + 1; c < N; c++)
+            {
+                _m.data[r][c] -= f * _m.data[k][c];
+            }
+        }
+    }
+    return true;
+}
+
+template<typename M, typename V>
+V luSolve(const M &_lu, const uint32 _pivot[], const V &_b)
+{
+    typedef typename solveTraits<M>::type T;
+    const uint32 N = M::ROWS;
+    V x;
+    for (uint32 i = 0; i < N; i++)
+    {
+        T sum = _b[_pivot[i]];
+        for (uint32 j = 0; j < i; j++)
+        {
+            sum -= _lu.data[i][j] * x[j];
+        }
+        x[i] = sum;
+    }
+    for (uint32 i = N; i-- > 0;)
+    {
+        T sum = x[i];
+        for (uint32 j = i + 1; j < N; j++)
+        {
+            sum -= _lu.data[i][j] * x[j];
+        }
+        x[i] = sum / _lu.data[i][i];
+    }
+    return x;
+}
+
+template<typename M, typename V>
+bool solve(const M &_a, const V &_b, V &_x)
+{
+    M lu = _a;
+    uint32 pivot[M::ROWS];
+    if (!luDecompose(lu, pivot))
+    {
+        return false;
+    }
+    _x = luSolve(lu, pivot, _b);
+    return true;
+}
+
+// Cholesky A = L * transpose(L) for symmetric positive definite A, _m becomes L (upper part zeroed)
+template<typename M>
+bool choleskyDecompose(M &_m)
+{
+    typedef typename solveTraits<M>::type T;
+    const uint32 N = M::ROWS;
+    for (uint32 j = 0; j < N; j++)
+    {
+        T d = _m.data[j][j];
+        for (uint32 k = 0; k < j; k++)
+        {
+            d -= _m.data[j][k] * _m.data[j][k];
+        }
+        if (d <= 0.0)
+        {
+            return false;
+        }
+        const T l   = std::sqrt(d);
+        const T inv = 1.0 / l;
+        _m.data[j][j] = l;
+        for (uint32 i = j + 1; i < N; i++)
+        {
+            T sum = _m.data[i][j];
+            for (uint32 k = 0; k < j; k++)
+            {
+                sum -= _m.data[i][k] * _m.data[j][k];
+            }
+            _m.data[i][j] = sum * inv;
+            _m.data[j][i] = 0.0;
+        }
+    }
+    return true;
+}
+
+template<typename M, typename V>
+V choleskySolve(const M &_l, const V &_b)
+{
+    typedef typename solveTraits<M>::type T;
+    const uint32 N = M::ROWS;
+    V x;
+    for (uint32 i = 0; i < N; i++)
+    {
+        T sum = _b[i];
+        for (uint32 j = 0; j < i; j++)
+        {
+            sum -= _l.data[i][j] * x[j];
+        }
+        x[i] = sum / _l.data[i][i];
+    }
+    for (uint32 i = N; i-- > 0;)
+    {
+        T sum = x[i];
+        for (uint32 j = i + 1; j < N; j++)
+        {
+            sum -= _l.data[j][i] * x[j];
+        }
+        x[i] = sum / _l.data[i][i];
+    }
+    return x;
+}
+
+template<typename M, typename V>
+bool solveCholesky(const M &_a, const V &_b, V &_x)
+{
+    M l = _a;
+    if (!choleskyDecompose(l))
+    {
+        return false;
+    }
+    _x = choleskySolve(l, _b);
+    return true;
+}
+
+// 8 systems in lanes, padding lanes solve the identity
+template<uint32 N, typename M, typename V>
+void solveLoadLanes(const M *_a, const V *_b, const size_t _n, float32x8 _la[N][N], float32x8 _lb[N])
+{
+    alignas(32) float32 lane[8];
+    for (uint32 r = 0; r < N; r++)
+    {
+        for (uint32 c = 0; c < N; c++)
+        {
+            for (uint32 l = 0; l < 8; l++)
+            {
+                lane[l] = (l < _n) ? _a[l].data[r][c] : ((r == c) ? 1.0f : 0.0f);
+            }
+            _la[r][c] = simdLoad(lane);
+        }
+        for (uint32 l = 0; l < 8; l++)
+        {
+            lane[l] = (l < _n) ? _b[l][r] : 0.0f;
+        }
+        _lb[r] = simdLoad(lane);
+    }
+}
+
+template<uint32 N, typename V>
+void solveStoreLanes(V *_x, const size_t _n, const float32x8 _lx[N], const float32x8 &_failed)
+{
+    alignas(32) float32 lane[8];
+    for (uint32 r = 0; r < N; r++)
+    {
+        simdStore(lane, simdSelect(_failed, simdSet(0.0f), _lx[r]));
+        for (uint32 l = 0; l < _n; l++)
+        {
+            _x[l][r] = lane[l];
+        }
+    }
+}
+
+template<uint32 N, typename M, typename V>
+void solveBatchLanes(const M *_a, const V *_b, V *_x, const size_t _count)
+{
+    const float32x8 tiny = simdSet(std::numeric_limits<float32>::min());
+    for (size_t base = 0; base < _count; base += 8)
+    {
+        const size_t n = ((_count - base) < 8) ? (_count - base) : 8;
+        float32x8 a[N][N];
+        float32x8 b[N];
+        float32x8 x[N];
+        solveLoadLanes<N>(_a + base, _b + base, n, a, b);
+        float32x8 failed = simdSet(0.0f);
+        for (uint32 k = 0; k < N; k++)
+        {
+            // branch free partial pivoting, each lane swaps its larger rows up
+            for (uint32 r = k + 1; r < N; r++)
+            {
+                const float32x8 swap = simdGreater(simdAbs(a[r][k]), simdAbs(a[k][k]));
+                for (uint32 c = k; c < N; c++)
+                {
+                    simdSwap(a[k][c], a[r][c], swap);
+                }
+                simdSwap(b[k], b[r], swap);
+            }
+            failed = simdOr(failed, simdLessEqual(simdAbs(a[k][k]), tiny));
+            const float32x8 inv = simdSet(1.0f) / a[k][k];
+            for (uint32 r = k + 1; r < N; r++)
+            {
+                const float32x8 f = a[r][k] * inv;
+                for (uint32 c = k + 1; c < N; c++)
+                {
+                    a[r][c] = simdMadd(-f, a[k][c], a[r][c]);
+                }
+                b[r] = simdMadd(-f, b[k], b[r]);
+            }
+        }
+        for (uint32 i = N; i-- > 0;)
+        {
+            float32x8 sum = b[i];
+            for (uint32 j = i + 1; j < N; j++)
+            {
+                sum = simdMadd(-a[i][j], x[j], sum);
+            }
+            x[i] = sum / a[i][i];
+        }
+        solveStoreLanes<N>(_x + base, n, x, failed);
+    }
+}
+
+template<uint32 N, typename M, typename V>
+void solveCholeskyBatchLanes(const M *_a, const V *_b, V *_x, const size_t _count)
+{
+    const float32x8 zero = simdSet(0.0f);
+    const float32x8 one  = simdSet(1.0f);
+    for (size_t base = 0; base < _count; base += 8)
+    {
+        const size_t n = ((_count - base) < 8) ? (_count - base) : 8;
+        float32x8 a[N][N];
+        float32x8 b[N];
+        float32x8 x[N];
+        float32x8 inv[N];
+        solveLoadLanes<N>(_a + base, _b + base, n, a, b);
+        float32x8 failed = zero;
+        for (uint32 j = 0; j < N; j++)
+        {
+            float32x8 d = a[j][j];
+            for (uint32 k = 0; k < j; k++)
+            {
+                d = simdMadd(-a[j][k], a[j][k], d);
+            }
+            failed = simdOr(failed, simdLessEqual(d, zero));
+            d      = simdSelect(failed, one, d);
+            inv[j] = simdRsqrt(d);
+            inv[j] = inv[j] * (simdSet(1.5f) - (simdSet(0.5f) * d * inv[j] * inv[j]));
+            for (uint32 i = j + 1; i < N; i++)
+            {
+                float32x8 sum = a[i][j];
+                for (uint32 k = 0; k < j; k++)
+                {
+                    sum = simdMadd(-a[i][k], a[j][k], sum);
+                }
+                a[i][j] = sum * inv[j];
+            }
+        }
+        for (uint32 i = 0; i < N; i++)
+        {
+            float32x8 sum = b[i];
+            for (uint32 j = 0; j < i; j++)
+            {
+                sum = simdMadd(-a[i][j], x[j], sum);
+            }
+            x[i] = sum * inv[i];
+        }
+        for (uint32 i = N; i-- > 0;)
+        {
+            float32x8 sum = x[i];
+            for (uint32 j = i + 1; j < N; j++)
+            {
+                sum = simdMadd(-a[j][i], x[j], sum);
+            }
+            x[i] = sum * inv[i];
+        }
+        solveStoreLanes<N>(_x + base, n, x, failed);
+    }
+}
+
+template<typename M, typename V>
+void solveBatch(const M *_a, const V *_b, V *_x, const size_t _count)
+{
+    if constexpr (std::is_same<typename solveTraits<M>::type, float32>::value)
+    {
+        solveBatchLanes<M::ROWS>(_a, _b, _x, _count);
+    }
+    else
+    {
+        for (size_t i = 0; i < _count; i++)
+        {
+            if (!solve(_a[i], _b[i], _x[i]))
+            {
+                _x[i] = V(0.0);
+            }
+        }
+    }
+}
+
+template<typename M, typename V>
+void solveCholeskyBatch(const M *_a, const V *_b, V *_x, const size_t _count)
+{
+    if constexpr (std::is_same<typename solveTraits<M>::type, float32>::value)
+    {
+        solveCholeskyBatchLanes<M::ROWS>(_a, _b, _x, _count);
+    }
+    else
+    {
+        for (size_t i = 0; i < _count; i++)
+        {
+            if (!solveCholesky(_a[i], _b[i], _x[i]))
+            {
+                _x[i] = V(0.0);
+            }
+        }
+    }
+}
+
+#endif // LIB_MATH_SOLVE_HPP
@@ -21,26 +21,85 @@
  * @date 2020-04-23
  */
 
+#include "libMath_instrument.hpp"
 #include "libMath_sqrt.hpp"
 
-float64 Q_rsqrt(float64 _number)
-{
-    uint32_t i;
-    float64 x2, y;
-    const float64 threeHalfs = 1.5f;
+// compile time evaluation checks, Q_rsqrt(x) * sqrt(x) within the documented 2e-3 of 1
+static_assert((Q_rsqrt(4.0f) > 0.5f * 0.998f) && (Q_rsqrt(4.0f) < 0.5f * 1.002f));
+static_assert((Q_rsqrt(0.01f) > 10.0f * 0.998f) && (Q_rsqrt(0.01f) < 10.0f * 1.002f));
+static_assert((Q_rsqrt(1.0e-36f) > 1.0e18f * 0.998f) && (Q_rsqrt(1.0e-36f) < 1.0e18f * 1.002f));
+static_assert((Q_rsqrt(1.0e36f) > 1.0e-18f * 0.998f) && (Q_rsqrt(1.0e36f) < 1.0e-18f * 1.002f));
+static_assert((Q_rsqrt(4.0) > 0.5 * 0.998) && (Q_rsqrt(4.0) < 0.5 * 1.002));
+static_assert((Q_rsqrt(1.0e-300) > 1.0e150 * 0.998) && (Q_rsqrt(1.0e-300) < 1.0e150 * 1.002));
 
-    x2 = _number * 0.5f;
-    y  = _number;
-    i  = * (uint32_t*) &y;
-    i  = 0x5f3759df - ( i >> 1 );
-    y  = * (float64*) &i;
-    y  = y * (threeHalfs - (x2 * y * y));
-    return y;
+void rsqrt(const float32 *_in, float32 *_out, const size_t _count)
+{
+    LIB_MATH_INSTRUMENT_SCOPE(INSTRUMENT_RSQRT_BATCH, _count);
+    size_t i = 0;
+#if defined(LIB_MATH_AVX)
+    const __m256 half       = _mm256_set1_ps(0.5f);
+    const __m256 threeHalfs = _mm256_set1_ps(1.5f);
+    const __m256 one        = _mm256_set1_ps(1.0f);
+    const __m256 normal     = _mm256_set1_ps(std::numeric_limits<float32>::min());
+    for (; (i + 8) <= _count; i += 8)
+    {
+        const __m256 x = _mm256_loadu_ps(_in + i);
+        const __m256 y = _mm256_rsqrt_ps(x);
+        const __m256 n = _mm256_sub_ps(threeHalfs, _mm256_mul_ps(_mm256_mul_ps(half, x), _mm256_mul_ps(y, y)));
+        __m256 r = _mm256_mul_ps(y, n);
+        // subnormal lanes (flushed to 0 by the estimate) use 1/sqrt
+        const __m256 small = _mm256_cmp_ps(x, normal, _CMP_LT_OQ);
+        if (_mm256_movemask_ps(small) != 0)
+        {
+            r = _mm256_blendv_ps(r, _mm256_div_ps(one, _mm256_sqrt_ps(x)), small);
+        }
+        _mm256_storeu_ps(_out + i, r);
+    }
+#elif defined(LIB_MATH_SSE)
+    const __m128 half       = _mm_set1_ps(0.5f);
+    const __m128 threeHalfs = _mm_set1_ps(1.5f);
+    const __m128 one        = _mm_set1_ps(1.0f);
+    const __m128 normal     = _mm_set1_ps(std::numeric_limits<float32>::min());
+    for (; (i + 4) <= _count; i += 4)
+    {
+        const __m128 x = _mm_loadu_ps(_in + i);
+        const __m128 y = _mm_rsqrt_ps(x);
+        const __m128 n = _mm_sub_ps(threeHalfs, _mm_mul_ps(_mm_mul_ps(half, x), _mm_mul_ps(y, y)));
+        __m128 r = _mm_mul_ps(y, n);
+        // subnormal lanes (flushed to 0 by the estimate) use 1/sqrt
+        const __m128 small = _mm_cmplt_ps(x, normal);
+        if (_mm_movemask_ps(small) != 0)
+        {
+            r = _mm_or_ps(_mm_andnot_ps(small, r), _mm_and_ps(small, _mm_div_ps(one, _mm_sqrt_ps(x))));
+        }
+        _mm_storeu_ps(_out + i, r);
+    }
+#endif
+    for (; i < _count; i++)
+    {
+        _out[i] = rsqrt(_in[i]);
+    }
 }
 
-float64 rsqrt(float64 _x)
+void rsqrt(const float64 *_in, float64 *_out, const size_t _count)
 {
-    float64 y;
-    asm("rsqrtss %[_x], %%xmm0;" "movss %%xmm0, %[y];" : : [ _x ] "m" ( _x ), [ y ] "m" ( y ) : "xmm0");
-    return y;
+    LIB_MATH_INSTRUMENT_SCOPE(INSTRUMENT_RSQRT_BATCH, _count);
+    size_t i = 0;
+#if defined(LIB_MATH_AVX)
+    const __m256d one = _mm256_set1_pd(1.0);
+    for (; (i + 4) <= _count; i += 4)
+    {
+        _mm256_storeu_pd(_out + i, _mm256_div_pd(one, _mm256_sqrt_pd(_mm256_loadu_pd(_in + i))));
+    }
+#elif defined(LIB_MATH_SSE)
+    const __m128d one = _mm_set1_pd(1.0);
+    for (; (i + 2) <= _count; i += 2)
+    {
+        _mm_storeu_pd(_out + i, _mm_div_pd(one, _mm_sqrt_pd(_mm_loadu_pd(_in + i))));
+    }
+#endif
+    for (; i < _count; i++)
+    {
+        _out[i] = 1.0 / std::sqrt(_in[i]);
+    }
 }
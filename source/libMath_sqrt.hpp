@@ -26,8 +26,64 @@
 
 #include "libMath_defines.hpp"
 #include "libMath_includes.hpp"
+#include "libMath_simd.hpp"
 
-float64 Q_rsqrt(float64 _number);
-float64 rsqrt(float64 _x);
+#include <bit>
+#include <limits>
 
-#endif // LIB_MATH_SQRT_HPP
\ No newline at end of file
+// Reciprocal square root, inputs must be positive and finite.
+// float32: hardware estimate and one Newton-Raphson step, relative error < 5e-7 (scalar 1/sqrt without SSE),
+//          subnormal inputs (flushed to 0 by the estimate) use 1/sqrt.
+// float64: float32 estimate and two Newton-Raphson steps, relative error < 1e-13,
+//          inputs outside the float32 range use 1/sqrt.
+// Q_rsqrt: bit trick and one Newton-Raphson step, relative error < 2e-3 for normal inputs.
+
+inline float32 rsqrt(const float32 _x)
+{
+#if defined(LIB_MATH_SSE)
+    if (_x >= std::numeric_limits<float32>::min())
+    {
+        const float32 y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(_x)));
+        return y * (1.5f - (0.5f * _x * y * y));
+    }
+    return 1.0f / std::sqrt(_x);
+#else
+    return 1.0f / std::sqrt(_x);
+#endif
+}
+
+inline float64 rsqrt(const float64 _x)
+{
+#if defined(LIB_MATH_SSE)
+    if ((_x >= std::numeric_limits<float32>::min()) && (_x <= std::numeric_limits<float32>::max()))
+    {
+        float64 y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(static_cast<float32>(_x))));
+        y = y * (1.5 - (0.5 * _x * y * y));
+        y = y * (1.5 - (0.5 * _x * y * y));
+        return y;
+    }
+#endif
+    return 1.0 / std::sqrt(_x);
+}
+
+constexpr float32 Q_rsqrt(const float32 _number)
+{
+    const float32 x2 = _number * 0.5f;
+    float32 y = std::bit_cast<float32>(0x5f3759dfu - (std::bit_cast<uint32>(_number) >> 1));
+    y = y * (1.5f - (x2 * y * y));
+    return y;
+}
+
+constexpr float64 Q_rsqrt(const float64 _number)
+{
+    const float64 x2 = _number * 0.5;
+    float64 y = std::bit_cast<float64>(0x5fe6eb50c7b537a9ull - (std::bit_cast<uint64>(_number) >> 1));
+    y = y * (1.5 - (x2 * y * y));
+    return y;
+}
+
+// batch versions, _in and _out may alias
+void rsqrt(const float32 *_in, float32 *_out, const size_t _count);
+void rsqrt(const float64 *_in, float64 *_out, const size_t _count);
+
+#endif // LIB_MATH_SQRT_HPP
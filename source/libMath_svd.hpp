@@ -0,0 +1,371 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_SVD_HPP
+#define LIB_MATH_SVD_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_matrix.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_quaternion.hpp"
+#include "libMath_simd.hpp"
+#include "libMath_vector.hpp"
+
+#define LIB_MATH_SVD_SWEEPS  6      // Jacobi sweeps, fewer leave outliers unconverged
+#define LIB_MATH_SVD_EPSILON 1.0e-6 // QR Givens threshold
+#define LIB_MATH_SVD_GRAIN   1024   // minimum matrices per thread
+
+// 3x3 SVD A = U * diag(sigma) * transpose(V) after McAdams et al. "Computing the Singular Value
+// Decomposition of 3x3 matrices with minimal branching and elementary floating point operations".
+// Fixed Jacobi sweeps with approximate Givens rotations diagonalize transpose(A) * A, V is kept as a
+// quaternion, the columns of A * V are sorted by descending norm and a Givens QR yields U and sigma.
+// U and V are rotations, for det(A) < 0 the sign goes to sigma.z. The kernels only use the lane
+// functions of libMath_simd.hpp and run on float32 / float64 or 8 matrices per float32x8.
+
+// appends the rotation by the half angle (_ch, _sh) in the (P, Q) plane to the quaternion _q (s, x, y, z)
+template<uint32 P, uint32 Q, typename L>
+inline void svdAccumulate(L _q[4], const L &_ch, const L &_sh)
+{
+    constexpr uint32 K = 3 - P - Q;
+    const L s = _q[0];
+    const L x = _q[1];
+    const L y = _q[2];
+    const L z = _q[3];
+    if constexpr (K == 0)
+    {
+        _q[0] = (s * _ch) - (x * _sh);
+        _q[1] = (x * _ch) + (s * _sh);
+        _q[2] = (y * _ch) + (z * _sh);
+        _q[3] = (z * _ch) - (y * _sh);
+    }
+    else if constexpr (K == 1)
+    {
+        // the (0, 2) plane turns about -y
+        _q[0] = (s * _ch) + (y * _sh);
+        _q[1] = (x * _ch) + (z * _sh);
+        _q[2] = (y * _ch) - (s * _sh);
+        _q[3] = (z * _ch) - (x * _sh);
+    }
+    else
+    {
+        _q[0] = (s * _ch) - (z * _sh);
+        _q[1] = (x * _ch) + (y * _sh);
+        _q[2] = (y * _ch) - (x * _sh);
+        _q[3] = (z * _ch) + (s * _sh);
+    }
+}
+
+template<typename L>
+inline void svdNormalize(L _q[4])
+{
+    const L il = simdRsqrt(simdMadd(_q[0], _q[0], simdMadd(_q[1], _q[1], simdMadd(_q[2], _q[2], _q[3] * _q[3]))));
+    for (uint32 i = 0; i < 4; i++)
+    {
+        _q[i] = _q[i] * il;
+    }
+}
+
+template<typename L>
+inline void svdQuatToMat(const L _q[4], L _m[3][3])
+{
+    const L one = simdSplat<L>(1.0);
+    const L two = simdSplat<L>(2.0);
+    const L xx = _q[1] * _q[1]; const L yy = _q[2] * _q[2]; const L zz = _q[3] * _q[3];
+    const L xy = _q[1] * _q[2]; const L xz = _q[1] * _q[3]; const L yz = _q[2] * _q[3];
+    const L sx = _q[0] * _q[1]; const L sy = _q[0] * _q[2]; const L sz = _q[0] * _q[3];
+    _m[0][0] = one - two * (yy + zz); _m[0][1] = two * (xy - sz);       _m[0][2] = two * (xz + sy);
+    _m[1][0] = two * (xy + sz);       _m[1][1] = one - two * (xx + zz); _m[1][2] = two * (yz - sx);
+    _m[2][0] = two * (xz - sy);       _m[2][1] = two * (yz + sx);       _m[2][2] = one - two * (xx + yy);
+}
+
+// one approximate Jacobi rotation of the symmetric _s, zeroes _s[P][Q]
+template<uint32 P, uint32 Q, typename L>
+inline void svdJacobi(L _s[3][3], L _qv[4])
+{
+    constexpr uint32 K = 3 - P - Q;
+    const L zero  = simdSplat<L>(0.0);
+    const L gamma = simdSplat<L>(5.82842712474619);  // 3 + 2 * sqrt(2)
+    const L cstar = simdSplat<L>(0.923879532511287); // cos(pi / 8)
+    const L sstar = simdSplat<L>(0.382683432365090); // sin(pi / 8)
+    L ch = simdSplat<L>(2.0) * (_s[P][P] - _s[Q][Q]);
+    L sh = _s[P][Q];
+    const auto accurate = simdLess(gamma * sh * sh, ch * ch);
+    const L w = simdRsqrt(simdMadd(ch, ch, sh * sh));
+    // past pi / 4 the approximation breaks down, turn by pi / 4 towards the off diagonal instead
+    const L sign = simdSelect(simdLess(ch, zero), -sh, sh);
+    ch = simdSelect(accurate, w * ch, cstar);
+    sh = simdSelect(accurate, w * sh, simdSelect(simdLess(sign, zero), -sstar, sstar));
+    const L c  = (ch * ch) - (sh * sh);
+    const L s  = simdSplat<L>(2.0) * ch * sh;
+    const L cc = c * c;
+    const L ss = s * s;
+    const L cs = c * s;
+    const L spp = _s[P][P]; const L sqq = _s[Q][Q]; const L spq = _s[P][Q];
+    const L spk = _s[P][K]; const L sqk = _s[Q][K];
+    _s[P][P] = (cc * spp) + (simdSplat<L>(2.0) * cs * spq) + (ss * sqq);
+    _s[Q][Q] = (ss * spp) - (simdSplat<L>(2.0) * cs * spq) + (cc * sqq);
+    _s[P][Q] = _s[Q][P] = ((cc - ss) * spq) - (cs * (spp - sqq));
+    _s[P][K] = _s[K][P] = (c * spk) + (s * sqk);
+    _s[Q][K] = _s[K][Q] = (c * sqk) - (s * spk);
+    svdAccumulate<P, Q>(_qv, ch, sh);
+}
+
+// moves the larger column of _b to P, negating the other keeps V a rotation (a quarter turn)
+template<uint32 P, uint32 Q, typename L>
+inline void svdSort(L _b[3][3], L _rho[3], L _qv[4])
+{
+    const L zero = simdSplat<L>(0.0);
+    const L one  = simdSplat<L>(1.0);
+    const L half = simdSplat<L>(0.707106781186548); // sqrt(0.5)
+    const auto swap = simdLess(_rho[P], _rho[Q]);
+    for (uint32 r = 0; r < 3; r++)
+    {
+        const L bp = _b[r][P];
+        _b[r][P] = simdSelect(swap, _b[r][Q], bp);
+        _b[r][Q] = simdSelect(swap, -bp, _b[r][Q]);
+    }
+    simdSwap(_rho[P], _rho[Q], swap);
+    svdAccumulate<P, Q>(_qv, simdSelect(swap, half, one), simdSelect(swap, half, zero));
+}
+
+// Givens rotation zeroing _b[Q][P], applied to the rows of _b and appended to U
+template<uint32 P, uint32 Q, typename L>
+inline void svdQr(L _b[3][3], L _qu[4])
+{
+    const L zero = simdSplat<L>(0.0);
+    const L eps  = simdSplat<L>(LIB_MATH_SVD_EPSILON);
+    const L a1   = _b[P][P];
+    const L a2   = _b[Q][P];
+    const L rho  = simdSqrt(simdMadd(a1, a1, a2 * a2));
+    L sh = simdSelect(simdGreater(rho, eps), a2, zero);
+    L ch = simdAbs(a1) + simdMax(rho, eps);
+    simdSwap(ch, sh, simdLess(a1, zero));
+    const L w = simdRsqrt(simdMadd(ch, ch, sh * sh));
+    ch = ch * w;
+    sh = sh * w;
+    const L c = (ch * ch) - (sh * sh);
+    const L s = simdSplat<L>(2.0) * ch * sh;
+    for (uint32 i = 0; i < 3; i++)
+    {
+        const L bp = _b[P][i];
+        const L bq = _b[Q][i];
+        _b[P][i] = (c * bp) + (s * bq);
+        _b[Q][i] = (c * bq) - (s * bp);
+    }
+    svdAccumulate<P, Q>(_qu, ch, sh);
+}
+
+// _qu and _qv are the unit quaternions of U and V
+template<typename L>
+void svdLanes(const L _a[3][3], L _qu[4], L _sigma[3], L _qv[4])
+{
+    const L zero = simdSplat<L>(0.0);
+    const L one  = simdSplat<L>(1.0);
+    L s[3][3];
+    for (uint32 i = 0; i < 3; i++)
+    {
+        for (uint32 j = 0; j < 3; j++)
+        {
+            s[i][j] = simdMadd(_a[0][i], _a[0][j], simdMadd(_a[1][i], _a[1][j], _a[2][i] * _a[2][j]));
+        }
+    }
+    _qv[0] = one;
+    _qv[1] = _qv[2] = _qv[3] = zero;
+    for (uint32 sweep = 0; sweep < LIB_MATH_SVD_SWEEPS; sweep++)
+    {
+        svdJacobi<0, 1>(s, _qv);
+        svdJacobi<1, 2>(s, _qv);
+        svdJacobi<0, 2>(s, _qv);
+    }
+    svdNormalize(_qv);
+    L v[3][3];
+    L b[3][3];
+    svdQuatToMat(_qv, v);
+    for (uint32 i = 0; i < 3; i++)
+    {
+        for (uint32 j = 0; j < 3; j++)
+        {
+            b[i][j] = simdMadd(_a[i][0], v[0][j], simdMadd(_a[i][1], v[1][j], _a[i][2] * v[2][j]));
+        }
+    }
+    L rho[3];
+    for (uint32 j = 0; j < 3; j++)
+    {
+        rho[j] = simdMadd(b[0][j], b[0][j], simdMadd(b[1][j], b[1][j], b[2][j] * b[2][j]));
+    }
+    svdSort<0, 1>(b, rho, _qv);
+    svdSort<0, 2>(b, rho, _qv);
+    svdSort<1, 2>(b, rho, _qv);
+    _qu[0] = one;
+    _qu[1] = _qu[2] = _qu[3] = zero;
+    svdQr<0, 1>(b, _qu);
+    svdQr<0, 2>(b, _qu);
+    svdQr<1, 2>(b, _qu);
+    svdNormalize(_qu);
+    for (uint32 i = 0; i < 3; i++)
+    {
+        _sigma[i] = b[i][i];
+    }
+}
+
+// calls _func(i, qu, sigma, qv) with scalar arrays for each matrix, float32 runs 8 matrices per lane set
+template<typename T, typename F>
+void svdRange(const mat3_t<T> *_a, const size_t _begin, const size_t _end, F &&_func)
+{
+    if constexpr (std::is_same<T, float32>::value)
+    {
+        alignas(32) float32 lane[8];
+        for (size_t base = _begin; base < _end; base += 8)
+        {
+            const size_t n = ((_end - base) < 8) ? (_end - base) : 8;
+            float32x8 a[3][3];
+            float32x8 qu[4];
+            float32x8 sigma[3];
+            float32x8 qv[4];
+            for (uint32 r = 0; r < 3; r++)
+            {
+                for (uint32 c = 0; c < 3; c++)
+                {
+                    for (uint32 l = 0; l < 8; l++)
+                    {
+                        lane[l] = (l < n) ? _a[base + l].data[r][c] : ((r == c) ? 1.0f : 0.0f);
+                    }
+                    a[r][c] = simdLoad(lane);
+                }
+            }
+            svdLanes(a, qu, sigma, qv);
+            alignas(32) float32 out[11][8];
+            for (uint32 i = 0; i < 4; i++)
+            {
+                simdStore(out[i], qu[i]);
+                simdStore(out[7 + i], qv[i]);
+            }
+            for (uint32 i = 0; i < 3; i++)
+            {
+                simdStore(out[4 + i], sigma[i]);
+            }
+            for (size_t l = 0; l < n; l++)
+            {
+                const float32 tqu[4]    = { out[0][l], out[1][l], out[2][l], out[3][l] };
+                const float32 tsigma[3] = { out[4][l], out[5][l], out[6][l] };
+                const float32 tqv[4]    = { out[7][l], out[8][l], out[9][l], out[10][l] };
+                _func(base + l, tqu, tsigma, tqv);
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            T qu[4];
+            T sigma[3];
+            T qv[4];
+            svdLanes(_a[i].data, qu, sigma, qv);
+            _func(i, qu, sigma, qv);
+        }
+    }
+}
+
+template<typename T>
+void svd(const mat3_t<T> &_a, mat3_t<T> &_u, vec3_t<T> &_sigma, mat3_t<T> &_v)
+{
+    T qu[4];
+    T sigma[3];
+    T qv[4];
+    svdLanes(_a.data, qu, sigma, qv);
+    svdQuatToMat(qu, _u.data);
+    svdQuatToMat(qv, _v.data);
+    _sigma = vec3_t<T>(sigma[0], sigma[1], sigma[2]);
+}
+
+// polar decomposition A = R * P, R = U * transpose(V) the closest rotation, P = V * diag(sigma) * transpose(V)
+template<typename T>
+quaternion<T> polarRotation(const mat3_t<T> &_a)
+{
+    T qu[4];
+    T sigma[3];
+    T qv[4];
+    svdLanes(_a.data, qu, sigma, qv);
+    return (quaternion<T>(qu[0], qu[1], qu[2], qu[3]) * quaternion<T>(qv[0], -qv[1], -qv[2], -qv[3])).normalized();
+}
+
+template<typename T>
+void polarDecompose(const mat3_t<T> &_a, mat3_t<T> &_r, mat3_t<T> &_p)
+{
+    mat3_t<T> u;
+    mat3_t<T> v;
+    vec3_t<T> sigma;
+    svd(_a, u, sigma, v);
+    mat3_t<T> vt = v;
+    vt.transpose();
+    _r = u * vt;
+    for (uint32 i = 0; i < 3; i++)
+    {
+        for (uint32 j = 0; j < 3; j++)
+        {
+            v.data[i][j] *= sigma[j];
+        }
+    }
+    _p = v * vt;
+}
+
+template<typename T>
+void svdBatch(const mat3_t<T> *_a, mat3_t<T> *_u, vec3_t<T> *_sigma, mat3_t<T> *_v, const size_t _count)
+{
+    parallelFor(_count, LIB_MATH_SVD_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        svdRange(_a, _begin, _end, [&](const size_t _i, const T _qu[4], const T _s[3], const T _qv[4])
+        {
+            svdQuatToMat(_qu, _u[_i].data);
+            svdQuatToMat(_qv, _v[_i].data);
+            _sigma[_i] = vec3_t<T>(_s[0], _s[1], _s[2]);
+        });
+    });
+}
+
+template<typename T>
+void polarRotationBatch(const mat3_t<T> *_a, quaternion<T> *_r, const size_t _count)
+{
+    parallelFor(_count, LIB_MATH_SVD_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        svdRange(_a, _begin, _end, [&](const size_t _i, const T _qu[4], const T[3], const T _qv[4])
+        {
+            _r[_i] = (quaternion<T>(_qu[0], _qu[1], _qu[2], _qu[3]) * quaternion<T>(_qv[0], -_qv[1], -_qv[2], -_qv[3])).normalized();
+        });
+    });
+}
+
+template<typename T>
+void polarRotationBatch(const mat3_t<T> *_a, mat3_t<T> *_r, const size_t _count)
+{
+    parallelFor(_count, LIB_MATH_SVD_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        svdRange(_a, _begin, _end, [&](const size_t _i, const T _qu[4], const T[3], const T _qv[4])
+        {
+            _r[_i] = (quaternion<T>(_qu[0], _qu[1], _qu[2], _qu[3]) * quaternion<T>(_qv[0], -_qv[1], -_qv[2], -_qv[3])).toMat3();
+        });
+    });
+}
+
+#endif // LIB_MATH_SVD_HPP
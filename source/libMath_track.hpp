@@ -0,0 +1,252 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_TRACK_HPP
+#define LIB_MATH_TRACK_HPP
+
+#include "libMath_decompose.hpp"
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_quaternion.hpp"
+#include "libMath_vector.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#define LIB_MATH_TRACK_GRAIN 64 // minimum instances per thread
+
+// Keyframe tracks with structure of arrays keys, one array per component. Samplers take a per
+// instance cursor (the last key segment), monotonic playback advances it in O(1) and seeking
+// falls back to a binary search. Cubic is a Catmull-Rom spline through the keys with tangents
+// scaled to the non uniform key spacing, rotations are renormalized. Time is clamped to the
+// first / last key.
+
+enum trackTarget : uint32
+{
+    TRACK_TRANSLATION = 0,
+    TRACK_ROTATION,
+    TRACK_SCALE
+};
+
+enum trackInterpolation : uint32
+{
+    TRACK_STEP = 0,
+    TRACK_LINEAR,
+    TRACK_CUBIC
+};
+
+template<typename T>
+struct track_t
+{
+    std::vector<T> times;
+    std::vector<T> values[4]; // x, y, z or s, x, y, z for rotations
+    uint32 target        = TRACK_TRANSLATION;
+    uint32 interpolation = TRACK_LINEAR;
+    uint32 node          = 0;
+
+    uint32 components(void) const { return (target == TRACK_ROTATION) ? 4 : 3; }
+    uint32 size(void) const { return static_cast<uint32>(times.size()); }
+    void addKey(const T _time, const vec3_t<T> &_v) { times.push_back(_time); values[0].push_back(_v.x); values[1].push_back(_v.y); values[2].push_back(_v.z); }
+    void addKey(const T _time, const quaternion<T> &_q) { times.push_back(_time); values[0].push_back(_q.s); values[1].push_back(_q.v.x); values[2].push_back(_q.v.y); values[3].push_back(_q.v.z); }
+};
+
+template<typename T>
+struct clip_t
+{
+    std::vector<track_t<T>> tracks;
+    uint32 nodeCount = 0;
+};
+
+// key segment [k, k + 1] containing _time
+template<typename T>
+uint32 trackFind(const T *_times, const uint32 _count, const T _time, uint32 &_cursor)
+{
+    const uint32 k = (_cursor < _count) ? _cursor : 0;
+    if (_time >= _times[k])
+    {
+        if (((k + 1) >= _count) || (_time < _times[k + 1]))
+        {
+            return k;
+        }
+        if (((k + 2) >= _count) || (_time < _times[k + 2]))
+        {
+            _cursor = k + 1;
+            return _cursor;
+        }
+    }
+    const T *upper = std::upper_bound(_times, _times + _count, _time);
+    _cursor = (upper == _times) ? 0 : static_cast<uint32>(upper - _times) - 1;
+    return _cursor;
+}
+
+template<typename T>
+void trackSample(const track_t<T> &_track, const T _time, uint32 &_cursor, T _out[4])
+{
+    const uint32 n = _track.size();
+    const uint32 c = _track.components();
+    if (n == 0)
+    {
+        return;
+    }
+    const T *times = _track.times.data();
+    const uint32 k  = trackFind(times, n, _time, _cursor);
+    const uint32 k1 = ((k + 1) < n) ? k + 1 : k;
+    const T dt = times[k1] - times[k];
+    T u = (dt > 0.0) ? (_time - times[k]) / dt : 0.0;
+    u = (u < 0.0) ? 0.0 : (u > 1.0) ? 1.0 : u;
+    if ((_track.interpolation == TRACK_STEP) || (k == k1))
+    {
+        for (uint32 i = 0; i < c; i++)
+        {
+            _out[i] = _track.values[i][k];
+        }
+        return;
+    }
+    const bool rotation = (_track.target == TRACK_ROTATION);
+    if (_track.interpolation == TRACK_LINEAR)
+    {
+        if (rotation)
+        {
+            const quaternion<T> q0(_track.values[0][k],  _track.values[1][k],  _track.values[2][k],  _track.values[3][k]);
+            const quaternion<T> q1(_track.values[0][k1], _track.values[1][k1], _track.values[2][k1], _track.values[3][k1]);
+            const quaternion<T> q = quaternion<T>::slerp(q0, q1, u);
+            _out[0] = q.s; _out[1] = q.v.x; _out[2] = q.v.y; _out[3] = q.v.z;
+        }
+        else
+        {
+            for (uint32 i = 0; i < c; i++)
+            {
+                _out[i] = _track.values[i][k] + ((_track.values[i][k1] - _track.values[i][k]) * u);
+            }
+        }
+        return;
+    }
+    const uint32 k0 = (k > 0) ? k - 1 : k;
+    const uint32 k2 = ((k1 + 1) < n) ? k1 + 1 : k1;
+    // rotations are brought onto one hemisphere along the four keys
+    T sign0 = 1.0;
+    T sign1 = 1.0;
+    T sign2 = 1.0;
+    if (rotation)
+    {
+        T d0 = 0.0;
+        T d1 = 0.0;
+        T d2 = 0.0;
+        for (uint32 i = 0; i < 4; i++)
+        {
+            d0 += _track.values[i][k0] * _track.values[i][k];
+            d1 += _track.values[i][k1] * _track.values[i][k];
+        }
+        sign0 = (d0 < 0.0) ? -1.0 : 1.0;
+        sign1 = (d1 < 0.0) ? -1.0 : 1.0;
+        for (uint32 i = 0; i < 4; i++)
+        {
+            d2 += _track.values[i][k2] * _track.values[i][k1] * sign1;
+        }
+        sign2 = (d2 < 0.0) ? -1.0 : 1.0;
+    }
+    const T u2  = u * u;
+    const T u3  = u2 * u;
+    const T h00 = (2.0 * u3) - (3.0 * u2) + 1.0;
+    const T h10 = u3 - (2.0 * u2) + u;
+    const T h01 = (3.0 * u2) - (2.0 * u3);
+    const T h11 = u3 - u2;
+    const T s1  = dt / (times[k1] - times[k0]);
+    const T s2  = dt / (times[k2] - times[k]);
+    T l2 = 0.0;
+    for (uint32 i = 0; i < c; i++)
+    {
+        const T p0 = _track.values[i][k0] * sign0;
+        const T p1 = _track.values[i][k];
+        const T p2 = _track.values[i][k1] * sign1;
+        const T p3 = _track.values[i][k2] * sign2;
+        _out[i] = (h00 * p1) + (h10 * (p2 - p0) * s1) + (h01 * p2) + (h11 * (p3 - p1) * s2);
+        l2 += _out[i] * _out[i];
+    }
+    if (rotation && (l2 > 0.0))
+    {
+        const T il = 1.0 / std::sqrt(l2);
+        for (uint32 i = 0; i < 4; i++)
+        {
+            _out[i] *= il;
+        }
+    }
+}
+
+template<typename T>
+vec3_t<T> trackSampleVec3(const track_t<T> &_track, const T _time, uint32 &_cursor)
+{
+    T v[4] = { 0.0, 0.0, 0.0, 0.0 };
+    trackSample(_track, _time, _cursor, v);
+    return vec3_t<T>(v[0], v[1], v[2]);
+}
+
+template<typename T>
+quaternion<T> trackSampleRotation(const track_t<T> &_track, const T _time, uint32 &_cursor)
+{
+    T v[4] = { 1.0, 0.0, 0.0, 0.0 };
+    trackSample(_track, _time, _cursor, v);
+    return quaternion<T>(v[0], v[1], v[2], v[3]);
+}
+
+// Samples every track for each instance in one pass, instance i plays _times[i] with the cursors
+// _cursors[i * tracks.size() ...] and writes the local transforms _pose[i * nodeCount ...].
+// Channels without a track are left untouched, so _pose should start as the bind pose.
+// recompose() / recomposeBatch() build the local matrices.
+template<typename T>
+void clipSample(const clip_t<T> &_clip, const T *_times, uint32 *_cursors, decomposition_t<T> *_pose, const size_t _instances)
+{
+    const size_t trackCount = _clip.tracks.size();
+    parallelFor(_instances, LIB_MATH_TRACK_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            decomposition_t<T> *pose = _pose + (i * _clip.nodeCount);
+            uint32 *cursors = _cursors + (i * trackCount);
+            for (size_t j = 0; j < trackCount; j++)
+            {
+                const track_t<T> &track = _clip.tracks[j];
+                if (track.size() == 0)
+                {
+                    continue;
+                }
+                decomposition_t<T> &local = pose[track.node];
+                switch (track.target)
+                {
+                    case TRACK_TRANSLATION:
+                        local.translation = trackSampleVec3(track, _times[i], cursors[j]);
+                    break;
+                    case TRACK_ROTATION:
+                        local.rotation = trackSampleRotation(track, _times[i], cursors[j]);
+                    break;
+                    case TRACK_SCALE:
+                        local.scale = trackSampleVec3(track, _times[i], cursors[j]);
+                    break;
+                }
+            }
+        }
+    });
+}
+
+#endif // LIB_MATH_TRACK_HPP
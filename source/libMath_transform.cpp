@@ -23,114 +23,23 @@
 
 #include "libMath_transform.hpp"
 
-mat4 translate(const mat4 &_mat4, const vec4 &_transVec)
-{
-    mat4 tMat4(0.0f);
-    for (size_t i = 0; i < (_mat4.COLUMNS * _mat4.ROWS); i++)
-    {
-        tMat4.array[i] = _mat4.array[i];
-    }
-    for (size_t i = 0; i < (_transVec.SIZE - 1); i++)
-    {
-        tMat4.data[i][tMat4.COLUMNS - 1] = tMat4.data[i][tMat4.COLUMNS - 1] + _transVec.array[i];
-    }
-    return tMat4;
-}
-
-mat4 translate(const vec4 &_transVec)
-{
-    return translate(mat4(1), _transVec);
-}
-
-mat4 scale(const mat4 &_mat4, const vec4 &_scaleVec)
-{
-    mat4 tMat4(0.0f);
-    for (size_t i = 0; i < (_mat4.COLUMNS * _mat4.ROWS); i++)
-    {
-        tMat4.array[i] = _mat4.array[i];
-    }
-    for (size_t i = 0; i < (_scaleVec.SIZE - 1); i++)
-    {
-        tMat4.data[i][i] = tMat4.data[i][i] * _scaleVec.array[i];
-    }
-    return tMat4;
-}
-
-mat4 scale(const vec4 &_scaleVec)
-{
-    return scale(mat4(1), _scaleVec);
-}
-
-mat4 rotate(const mat4 &_mat4, const vec4 &_rotateVec)
-{
-    mat4 xMat4(1);
-    if (_rotateVec.x != 0)
-    {
-        float64 xs = sin(_rotateVec.x);
-        float64 xc = cos(_rotateVec.x);
-        xMat4.data[1][1] = xc;
-        xMat4.data[1][2] = xs * -1;
-        xMat4.data[2][1] = xs;
-        xMat4.data[2][2] = xc;
-    }
-    
-    mat4 yMat4(1);
-    if (_rotateVec.y != 0)
-    {
-        float64 ys = sin(_rotateVec.y);
-        float64 yc = cos(_rotateVec.y);
-        xMat4.data[0][0] = yc;
-        xMat4.data[0][2] = ys;
-        xMat4.data[2][0] = ys * -1;
-        xMat4.data[2][2] = yc;
-    }
-
-    mat4 zMat4(1);
-    if (_rotateVec.z != 0)
-    {
-        float64 zs = sin(_rotateVec.z);
-        float64 zc = cos(_rotateVec.z);
-        xMat4.data[0][0] = zc;
-        xMat4.data[0][1] = zs * -1;
-        xMat4.data[1][0] = zs;
-        xMat4.data[1][1] = zc;
-    }
-    
-    return _mat4 * xMat4 * yMat4 * zMat4;
-}
-
-mat4 rotate(const vec4 &_rotateVec)
-{
-    return rotate(mat4(1), _rotateVec);
-}
-
-mat4 orthographic(float64 _left, float64 _right, float64 _bottom, float64 _top, float64 _near, float64 _far)
-{
-    return mat4();
-}
-
-mat4 perspective(float64 _fov, float64 _aspect, float64 _near, float64 _far)
-{
-    mat4 tMat4(0.0f);
-    tMat4.data[0][0] = 1.0f / (tanf( _fov / 2.0f) * _aspect);
-    tMat4.data[1][1] = 1.0f / tanf( _fov / 2.0f);
-    tMat4.data[2][2] = ((-1.0 * _near) - _far) / (_near - _far);
-    tMat4.data[2][3] = 2.0f * _far * _near / (_near - _far);
-    tMat4.data[3][2] = 1.0f;
-    return tMat4;
-}
-
-mat4 perspective(float64 _fov, float64 _near, float64 _far)
-{
-    mat4 tMat4(0.0f);
-    tMat4.data[0][0] = 1.0f / tanf( _fov / 2.0f);
-    tMat4.data[1][1] = 1.0f / tanf( _fov / 2.0f);
-    tMat4.data[2][3] = -1.0f;
-    tMat4.data[3][2] = -1.0f * ((_far * _near) / (_far - _near));
-    return tMat4;
-}
-
-mat4 lookAt(vec3 _position, vec3 _target, vec3 _upVector)
-{
-    return mat4();
-}
+// compile time evaluation checks
+static_assert(translate(vec4(1.0f, 2.0f, 3.0f, 0.0f)).data[1][3] == 2.0f);
+static_assert(scale(vec4(2.0f, 3.0f, 4.0f, 1.0f)).data[2][2] == 4.0f);
+static_assert(translate(scale(vec4(2.0f)), vec4(5.0f)).data[0][3] == 5.0f);
+static_assert((translate(vec4(1.0f, 2.0f, 3.0f, 0.0f)) * vec4(0.0f, 0.0f, 0.0f, 1.0f)).z == 3.0f);
+static_assert(perspective(1.57079632679f, 1.0f, 0.1f, 100.0f).data[1][1] > 0.9999f);
+static_assert(perspective(1.57079632679f, 1.0f, 0.1f, 100.0f).data[1][1] < 1.0001f);
+static_assert(rotate(vec4(0.0f, 0.0f, 1.57079632679f, 0.0f)).data[1][0] > 0.9999f);
+static_assert((orthographic<float64>(-2.0, 2.0, -1.0, 3.0, 1.0, 5.0) * vec4_t<float64>(2.0, -1.0, 1.0, 1.0)).x == 1.0);
+static_assert((orthographic<float64>(-2.0, 2.0, -1.0, 3.0, 1.0, 5.0) * vec4_t<float64>(2.0, -1.0, 1.0, 1.0)).y == -1.0);
+static_assert((orthographic<float64>(-2.0, 2.0, -1.0, 3.0, 1.0, 5.0) * vec4_t<float64>(0.0, 0.0, 5.0, 1.0)).z == 1.0);
+static_assert(transformSqrt<float64>(16.0) == 4.0);
+static_assert((lookAt<float64>(vec3_t<float64>(1.0, 2.0, 3.0), vec3_t<float64>(1.0, 2.0, 7.0), vec3_t<float64>(0.0, 1.0, 0.0)) * vec4_t<float64>(1.0, 2.0, 7.0, 1.0)).z == 4.0);
+static_assert((lookAt<float64>(vec3_t<float64>(0.0), vec3_t<float64>(1.0, 0.0, 0.0), vec3_t<float64>(0.0, 1.0, 0.0)) * vec4_t<float64>(0.0, 0.0, -1.0, 1.0)).x == 1.0);
+static_assert(perspective<float64>(1.0, 2.0, 1.0, 10.0).data[3][2] == 1.0);
+static_assert(perspective<float64>(1.0, 1.0, 10.0).data[0][0] == perspective<float64>(1.0, 1.0, 1.0, 10.0).data[0][0]);
+static_assert(projectionPerspective<float64>(1.0, 2.0, 1.0, 10.0).matrix.data[2][3] == perspective<float64>(1.0, 2.0, 1.0, 10.0).data[2][3]);
+static_assert((projectionReverseZ<float64>(1.0, 1.0, 1.0, 10.0).matrix * vec4_t<float64>(0.0, 0.0, 1.0, 1.0)).z == 1.0);
+static_assert((projectionReverseZ<float64>(1.0, 1.0, 1.0, 10.0).matrix * vec4_t<float64>(0.0, 0.0, 10.0, 1.0)).z == 0.0);
+static_assert((projectionReverseZInfinite<float64>(1.0, 1.0, 0.5).inverse * vec4_t<float64>(0.0, 0.0, 1.0, 1.0)).w == 2.0);
@@ -21,30 +21,287 @@
  * @date 2020-04-23
  */
 
+#ifndef LIB_MATH_TRANSFORM_HPP
+#define LIB_MATH_TRANSFORM_HPP
+
 #include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
 #include "libMath_matrix.hpp"
 #include "libMath_vector.hpp"
 
+// constant evaluable trigonometry, <cmath> is used at run time
+template<typename T>
+constexpr T transformSin(T _x)
+{
+    if (!std::is_constant_evaluated())
+    {
+        return std::sin(_x);
+    }
+    const float64 twoPi = 2.0 * M_PI;
+    float64 x = static_cast<float64>(_x);
+    x -= twoPi * static_cast<float64>(static_cast<int64>(x / twoPi));
+    x  = (x > M_PI) ? x - twoPi : (x < -M_PI) ? x + twoPi : x;
+    x  = (x > (M_PI / 2.0)) ? M_PI - x : (x < -(M_PI / 2.0)) ? -M_PI - x : x;
+    float64 term = x;
+    float64 sum  = x;
+    for (int32 i = 1; i < 10; i++)
+    {
+        term *= -(x * x) / static_cast<float64>((2 * i) * (2 * i + 1));
+        sum  += term;
+    }
+    return static_cast<T>(sum);
+}
+
+template<typename T>
+constexpr T transformCos(T _x)
+{
+    if (!std::is_constant_evaluated())
+    {
+        return std::cos(_x);
+    }
+    return static_cast<T>(transformSin<float64>(static_cast<float64>(_x) + (M_PI / 2.0)));
+}
+
+template<typename T>
+constexpr T transformTan(T _x)
+{
+    if (!std::is_constant_evaluated())
+    {
+        return std::tan(_x);
+    }
+    return transformSin<T>(_x) / transformCos<T>(_x);
+}
+
+template<typename T>
+constexpr T transformSqrt(T _x)
+{
+    if (!std::is_constant_evaluated())
+    {
+        return std::sqrt(_x);
+    }
+    if (!(_x > 0.0))
+    {
+        return static_cast<T>(0.0);
+    }
+    float64 x = static_cast<float64>(_x);
+    float64 r = (x > 1.0) ? x : 1.0;
+    for (int32 i = 0; i < 128; i++)
+    {
+        const float64 n = 0.5 * (r + (x / r));
+        if (!(n < r))
+        {
+            break;
+        }
+        r = n;
+    }
+    return static_cast<T>(r);
+}
+
 // templated versions
-template<typename T> mat4_t<T> translate(const mat4_t<T> &_mat4, const vec4_t<T> &_transVec);
-template<typename T> mat4_t<T> translate(const vec4_t<T> &_transVec);
-template<typename T> mat4_t<T> scale(const mat4_t<T> &_mat4, const vec4_t<T> &_scaleVec);
-template<typename T> mat4_t<T> scale(const vec4_t<T> &_scaleVec);
-template<typename T> mat4_t<T> rotate(const mat4_t<T> &_mat4, const vec4_t<T> &_rotateVec);
-template<typename T> mat4_t<T> rotate(const vec4_t<T> &_rotateVec);
-template<typename T> mat4_t<T> orthographic(T _left, T _right, T _bottom, T _top, T _near, T _far);
-template<typename T> mat4_t<T> perspective(T _fov, T _aspect, T _near, T _far);
-template<typename T> mat4_t<T> perspective(T _fov, T _near, T _far);
-template<typename T> mat4_t<T> lookAt(vec3_t<T> _position, vec3_t<T> _target, vec3_t<T> _upVector);
+template<typename T>
+constexpr mat4_t<T> translate(const mat4_t<T> &_mat4, const vec4_t<T> &_transVec)
+{
+    mat4_t<T> tMat4 = _mat4;
+    for (size_t i = 0; i < (_transVec.SIZE - 1); i++)
+    {
+        tMat4.data[i][tMat4.COLUMNS - 1] = tMat4.data[i][tMat4.COLUMNS - 1] + _transVec[i];
+    }
+    return tMat4;
+}
+
+template<typename T>
+constexpr mat4_t<T> translate(const vec4_t<T> &_transVec)
+{
+    return translate(mat4_t<T>(1), _transVec);
+}
+
+template<typename T>
+constexpr mat4_t<T> scale(const mat4_t<T> &_mat4, const vec4_t<T> &_scaleVec)
+{
+    mat4_t<T> tMat4 = _mat4;
+    for (size_t i = 0; i < (_scaleVec.SIZE - 1); i++)
+    {
+        tMat4.data[i][i] = tMat4.data[i][i] * _scaleVec[i];
+    }
+    return tMat4;
+}
+
+template<typename T>
+constexpr mat4_t<T> scale(const vec4_t<T> &_scaleVec)
+{
+    return scale(mat4_t<T>(1), _scaleVec);
+}
+
+template<typename T>
+constexpr mat4_t<T> rotate(const mat4_t<T> &_mat4, const vec4_t<T> &_rotateVec)
+{
+    // x * y * z rotation composed in closed form, one 4x4 product instead of three
+    T xs = (_rotateVec.x != 0) ? transformSin<T>(_rotateVec.x) : 0;
+    T xc = (_rotateVec.x != 0) ? transformCos<T>(_rotateVec.x) : 1;
+    T ys = (_rotateVec.y != 0) ? transformSin<T>(_rotateVec.y) : 0;
+    T yc = (_rotateVec.y != 0) ? transformCos<T>(_rotateVec.y) : 1;
+    T zs = (_rotateVec.z != 0) ? transformSin<T>(_rotateVec.z) : 0;
+    T zc = (_rotateVec.z != 0) ? transformCos<T>(_rotateVec.z) : 1;
+
+    mat4_t<T> rMat4(1);
+    rMat4.data[0][0] = yc * zc;
+    rMat4.data[0][1] = yc * zs * -1;
+    rMat4.data[0][2] = ys;
+    rMat4.data[1][0] = (xs * ys * zc) + (xc * zs);
+    rMat4.data[1][1] = (xc * zc) - (xs * ys * zs);
+    rMat4.data[1][2] = xs * yc * -1;
+    rMat4.data[2][0] = (xs * zs) - (xc * ys * zc);
+    rMat4.data[2][1] = (xc * ys * zs) + (xs * zc);
+    rMat4.data[2][2] = xc * yc;
+
+    return _mat4 * rMat4;
+}
+
+template<typename T>
+constexpr mat4_t<T> rotate(const vec4_t<T> &_rotateVec)
+{
+    return rotate(mat4_t<T>(1), _rotateVec);
+}
+
+// same layout as perspective(): view space looks down +z, ndc depth -1 at _near, 1 at _far
+template<typename T>
+constexpr mat4_t<T> orthographic(T _left, T _right, T _bottom, T _top, T _near, T _far)
+{
+    mat4_t<T> tMat4(1);
+    tMat4.data[0][0] = static_cast<T>(2.0) / (_right - _left);
+    tMat4.data[0][3] = -(_right + _left) / (_right - _left);
+    tMat4.data[1][1] = static_cast<T>(2.0) / (_top - _bottom);
+    tMat4.data[1][3] = -(_top + _bottom) / (_top - _bottom);
+    tMat4.data[2][2] = static_cast<T>(2.0) / (_far - _near);
+    tMat4.data[2][3] = -(_far + _near) / (_far - _near);
+    return tMat4;
+}
+
+template<typename T>
+constexpr mat4_t<T> perspective(T _fov, T _aspect, T _near, T _far)
+{
+    const T focal = static_cast<T>(1.0) / transformTan<T>(_fov / static_cast<T>(2.0));
+    mat4_t<T> tMat4(0.0f);
+    tMat4.data[0][0] = focal / _aspect;
+    tMat4.data[1][1] = focal;
+    tMat4.data[2][2] = ((-1.0 * _near) - _far) / (_near - _far);
+    tMat4.data[2][3] = 2.0f * _far * _near / (_near - _far);
+    tMat4.data[3][2] = 1.0f;
+    return tMat4;
+}
+
+// square aspect ratio
+template<typename T>
+constexpr mat4_t<T> perspective(T _fov, T _near, T _far)
+{
+    return perspective<T>(_fov, static_cast<T>(1.0), _near, _far);
+}
+
+// Perspective projection with its analytic inverse. All builders share the layout of perspective():
+// view space looks down +z, clip w = view z, clip z = depthScale * z + depthOffset. ndcNear / ndcFar
+// give the ndc depth of the near / far planes for viewport_t (an infinite far plane maps to ndcFar).
+template<typename T>
+struct projection_t
+{
+    mat4_t<T> matrix;
+    mat4_t<T> inverse;
+    T depthScale  = 0.0;
+    T depthOffset = 0.0;
+    T ndcNear     = -1.0;
+    T ndcFar      = 1.0;
+};
+
+template<typename T>
+constexpr projection_t<T> projectionBuild(T _fov, T _aspect, T _depthScale, T _depthOffset, T _ndcNear, T _ndcFar)
+{
+    const T focal = static_cast<T>(1.0) / transformTan<T>(_fov / static_cast<T>(2.0));
+    projection_t<T> tProjection;
+    tProjection.matrix = mat4_t<T>(0.0f);
+    tProjection.matrix.data[0][0] = focal / _aspect;
+    tProjection.matrix.data[1][1] = focal;
+    tProjection.matrix.data[2][2] = _depthScale;
+    tProjection.matrix.data[2][3] = _depthOffset;
+    tProjection.matrix.data[3][2] = 1.0f;
+    tProjection.inverse = mat4_t<T>(0.0f);
+    tProjection.inverse.data[0][0] = _aspect / focal;
+    tProjection.inverse.data[1][1] = static_cast<T>(1.0) / focal;
+    tProjection.inverse.data[2][3] = 1.0f;
+    tProjection.inverse.data[3][2] = static_cast<T>(1.0) / _depthOffset;
+    tProjection.inverse.data[3][3] = -_depthScale / _depthOffset;
+    tProjection.depthScale  = _depthScale;
+    tProjection.depthOffset = _depthOffset;
+    tProjection.ndcNear     = _ndcNear;
+    tProjection.ndcFar      = _ndcFar;
+    return tProjection;
+}
+
+// same matrix as perspective(), ndc depth [-1, 1]
+template<typename T>
+constexpr projection_t<T> projectionPerspective(T _fov, T _aspect, T _near, T _far)
+{
+    return projectionBuild<T>(_fov, _aspect, (_near + _far) / (_far - _near), (static_cast<T>(-2.0) * _far * _near) / (_far - _near), static_cast<T>(-1.0), static_cast<T>(1.0));
+}
+
+// ndc depth 1 at the near plane, 0 at the far plane, spreads float depth precision evenly
+template<typename T>
+constexpr projection_t<T> projectionReverseZ(T _fov, T _aspect, T _near, T _far)
+{
+    return projectionBuild<T>(_fov, _aspect, -_near / (_far - _near), (_far * _near) / (_far - _near), static_cast<T>(1.0), static_cast<T>(0.0));
+}
+
+// ndc depth [-1, 1) with the far plane at infinity
+template<typename T>
+constexpr projection_t<T> projectionInfinite(T _fov, T _aspect, T _near)
+{
+    return projectionBuild<T>(_fov, _aspect, static_cast<T>(1.0), static_cast<T>(-2.0) * _near, static_cast<T>(-1.0), static_cast<T>(1.0));
+}
+
+// ndc depth = near / z, 1 at the near plane towards 0 at infinity
+template<typename T>
+constexpr projection_t<T> projectionReverseZInfinite(T _fov, T _aspect, T _near)
+{
+    return projectionBuild<T>(_fov, _aspect, static_cast<T>(0.0), _near, static_cast<T>(1.0), static_cast<T>(0.0));
+}
+
+// view matrix for perspective() / orthographic(): _target ends up on +z, _upVector towards +y
+template<typename T>
+constexpr mat4_t<T> lookAt(vec3_t<T> _position, vec3_t<T> _target, vec3_t<T> _upVector)
+{
+    auto unit = [](const vec3_t<T> &_v) -> vec3_t<T>
+    {
+        const T l = transformSqrt<T>(vec3_t<T>::dot(_v, _v));
+        return (l > 0.0) ? (_v * (static_cast<T>(1.0) / l)) : _v;
+    };
+    const vec3_t<T> forward = unit(_target - _position);
+    const vec3_t<T> right   = unit(vec3_t<T>::cross(_upVector, forward));
+    const vec3_t<T> up      = vec3_t<T>::cross(forward, right);
+    mat4_t<T> tMat4(1);
+    for (uint32 i = 0; i < 3; i++)
+    {
+        tMat4.data[0][i] = right[i];
+        tMat4.data[1][i] = up[i];
+        tMat4.data[2][i] = forward[i];
+    }
+    tMat4.data[0][3] = -vec3_t<T>::dot(right, _position);
+    tMat4.data[1][3] = -vec3_t<T>::dot(up, _position);
+    tMat4.data[2][3] = -vec3_t<T>::dot(forward, _position);
+    return tMat4;
+}
 
 // commonly used float32 versions
-mat4 translate(const mat4 &_mat4, const vec4 &_transVec);
-mat4 translate(const vec4 &_transVec);
-mat4 scale(const mat4 &_mat4, const vec4 &_scaleVec);
-mat4 scale(const vec4 &_scaleVec);
-mat4 rotate(const mat4 &_mat4, const vec4 &_rotateVec);
-mat4 rotate(const vec4 &_rotateVec);
-mat4 orthographic(float32 _left, float32 _right, float32 _bottom, float32 _top, float32 _near, float32 _far);
-mat4 perspective(float32 _fov, float32 _aspect, float32 _near, float32 _far);
-mat4 perspective(float32 _fov, float32 _near, float32 _far);
-mat4 lookAt(vec3 _position, vec3 _target, vec3 _upVector);
+constexpr mat4 translate(const mat4 &_mat4, const vec4 &_transVec) { return translate<float32>(_mat4, _transVec); }
+constexpr mat4 translate(const vec4 &_transVec) { return translate<float32>(_transVec); }
+constexpr mat4 scale(const mat4 &_mat4, const vec4 &_scaleVec) { return scale<float32>(_mat4, _scaleVec); }
+constexpr mat4 scale(const vec4 &_scaleVec) { return scale<float32>(_scaleVec); }
+constexpr mat4 rotate(const mat4 &_mat4, const vec4 &_rotateVec) { return rotate<float32>(_mat4, _rotateVec); }
+constexpr mat4 rotate(const vec4 &_rotateVec) { return rotate<float32>(_rotateVec); }
+constexpr mat4 orthographic(float32 _left, float32 _right, float32 _bottom, float32 _top, float32 _near, float32 _far) { return orthographic<float32>(_left, _right, _bottom, _top, _near, _far); }
+constexpr mat4 perspective(float32 _fov, float32 _aspect, float32 _near, float32 _far) { return perspective<float32>(_fov, _aspect, _near, _far); }
+constexpr mat4 perspective(float32 _fov, float32 _near, float32 _far) { return perspective<float32>(_fov, _near, _far); }
+constexpr projection_t<float32> projectionPerspective(float32 _fov, float32 _aspect, float32 _near, float32 _far) { return projectionPerspective<float32>(_fov, _aspect, _near, _far); }
+constexpr projection_t<float32> projectionReverseZ(float32 _fov, float32 _aspect, float32 _near, float32 _far) { return projectionReverseZ<float32>(_fov, _aspect, _near, _far); }
+constexpr projection_t<float32> projectionInfinite(float32 _fov, float32 _aspect, float32 _near) { return projectionInfinite<float32>(_fov, _aspect, _near); }
+constexpr projection_t<float32> projectionReverseZInfinite(float32 _fov, float32 _aspect, float32 _near) { return projectionReverseZInfinite<float32>(_fov, _aspect, _near); }
+constexpr mat4 lookAt(vec3 _position, vec3 _target, vec3 _upVector) { return lookAt<float32>(_position, _target, _upVector); }
+
+#endif // LIB_MATH_TRANSFORM_HPP
@@ -21,4 +21,13 @@
  * @date 2020-04-23
  */
 
-#include "libMath_vector_vec2.hpp"
\ No newline at end of file
+#include "libMath_vector_vec2.hpp"
+
+// compile time evaluation checks
+static_assert((vec2_t<float32>(1.0f, 2.0f) + vec2_t<float32>(3.0f)) == vec2_t<float32>(4.0f, 5.0f));
+static_assert(vec2_t<float32>(1.0f, 2.0f).cross(vec2_t<float32>(3.0f, 4.0f)) == -2.0f);
+static_assert((2.0f * vec2_t<float64>(1.0, 2.0))[1] == 4.0);
+
+// layout checks, bulkCopy() and GPU uploads rely on these
+static_assert(std::is_trivially_copyable<vec2_t<float32>>::value && std::is_standard_layout<vec2_t<float32>>::value);
+static_assert(std::is_trivially_copyable<vec2_t<float64>>::value && std::is_standard_layout<vec2_t<float64>>::value);
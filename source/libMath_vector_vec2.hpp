@@ -26,6 +26,7 @@
 
 #include "libMath_defines.hpp"
 #include "libMath_includes.hpp"
+#include "libMath_sqrt.hpp"
 
 template<typename T>
 struct vec2_t
@@ -39,46 +40,48 @@ struct vec2_t
     };
     
     // construnctors and destructor
-    vec2_t(void) { this->x = 0.0; this->y = 0.0; }
-    vec2_t(const T &_f) { this->x = _f; this->y = _f; }
-    vec2_t(const T &_x, const T &_y) { this->x = _x; this->y = _y; }
-    vec2_t(const vec2_t& _v) { this->x = _v.x; this->y = _v.y; }
+    constexpr vec2_t(void) : x(0.0), y(0.0) { }
+    constexpr vec2_t(const T &_f) : x(_f), y(_f) { }
+    constexpr vec2_t(const T &_x, const T &_y) : x(_x), y(_y) { }
+    constexpr vec2_t(const vec2_t& _v) = default;
     ~vec2_t(void) = default;
     
     // opperators
-    bool operator==(const vec2_t& _v) const { return (this->x == _v.x && this->y == _v.y); }
-    vec2_t& operator=(const vec2_t& _v) { this->x = _v.x; this->y = _v.y; return *this; }
-    vec2_t operator- (void) const { vec2_t v(-this->x, -this->y); return v; }
-    void operator+=(const vec2_t& _v) { this->x += _v.x; this->y += _v.y; }
-    vec2_t operator+(const vec2_t& _v) const { return vec2_t(this->x + _v.x, this->y + _v.y); }
-    void operator-=(const vec2_t& _v) { this->x -= _v.x; this->y -= _v.y; }
-    vec2_t operator-(const vec2_t& _v) const { return vec2_t(this->x - _v.x, this->y - _v.y); }
-    void operator*=(const T _s) { this->x *= _s; this->y *= _s; }
-    vec2_t operator*(const T _s) const {    return vec2_t(_s * this->x, _s * this->y); }
-    void operator /=(const T _s) { this->x /= _s; this->y /= _s; }
-    vec2_t operator/(const T _s) const {return vec2_t(this->x / _s, this->y / _s); }
-    T operator*(const vec2_t& _v) const { return this->x * _v.x + this->y * _v.y; }
-    void operator %=(const vec2_t& _v) { *this=cross(_v); }
-    T operator %(const vec2_t& _v) const { return this->x * _v.y - this->y * _v.x; }
-    T& operator[](uint32 _i) { return this->array[_i]; }
-    const T& operator[]( uint32 _i ) const { return this->array[_i]; }
+    constexpr bool operator==(const vec2_t& _v) const { return (this->x == _v.x && this->y == _v.y); }
+    constexpr vec2_t& operator=(const vec2_t& _v) = default;
+    constexpr vec2_t operator- (void) const { vec2_t v(-this->x, -this->y); return v; }
+    constexpr void operator+=(const vec2_t& _v) { this->x += _v.x; this->y += _v.y; }
+    constexpr vec2_t operator+(const vec2_t& _v) const { return vec2_t(this->x + _v.x, this->y + _v.y); }
+    constexpr void operator-=(const vec2_t& _v) { this->x -= _v.x; this->y -= _v.y; }
+    constexpr vec2_t operator-(const vec2_t& _v) const { return vec2_t(this->x - _v.x, this->y - _v.y); }
+    constexpr void operator*=(const T _s) { this->x *= _s; this->y *= _s; }
+    constexpr vec2_t operator*(const T _s) const {    return vec2_t(_s * this->x, _s * this->y); }
+    constexpr void operator /=(const T _s) { this->x /= _s; this->y /= _s; }
+    constexpr vec2_t operator/(const T _s) const {return vec2_t(this->x / _s, this->y / _s); }
+    constexpr T operator*(const vec2_t& _v) const { return this->x * _v.x + this->y * _v.y; }
+    constexpr void operator %=(const vec2_t& _v) { *this=cross(_v); }
+    constexpr T operator %(const vec2_t& _v) const { return this->x * _v.y - this->y * _v.x; }
+    constexpr T& operator[](uint32 _i) { if (std::is_constant_evaluated()) return (_i == 0) ? this->x : this->y; return this->array[_i]; }
+    constexpr const T& operator[]( uint32 _i ) const { if (std::is_constant_evaluated()) return (_i == 0) ? this->x : this->y; return this->array[_i]; }
 
-    friend vec2_t operator+ (const T &_vl, const vec2_t &_vr) { vec2_t v(_vl + _vr.x, _vl + _vr.y); return v; }
-    friend vec2_t operator- (const T &_vl, const vec2_t &_vr) { vec2_t v(_vl - _vr.x, _vl - _vr.y); return v; }
-    friend vec2_t operator* (const T &_vl, const vec2_t &_vr) { vec2_t v(_vl * _vr.x, _vl * _vr.y); return v; }
-    friend vec2_t operator/ (const T &_vl, const vec2_t &_vr) { vec2_t v(_vl / _vr.x, _vl / _vr.y); return v; }
+    friend constexpr vec2_t operator+ (const T &_vl, const vec2_t &_vr) { vec2_t v(_vl + _vr.x, _vl + _vr.y); return v; }
+    friend constexpr vec2_t operator- (const T &_vl, const vec2_t &_vr) { vec2_t v(_vl - _vr.x, _vl - _vr.y); return v; }
+    friend constexpr vec2_t operator* (const T &_vl, const vec2_t &_vr) { vec2_t v(_vl * _vr.x, _vl * _vr.y); return v; }
+    friend constexpr vec2_t operator/ (const T &_vl, const vec2_t &_vr) { vec2_t v(_vl / _vr.x, _vl / _vr.y); return v; }
 
     // functions
-    uint32 size(void) { return SIZE; }
-    T length(void){ return std::sqrt((x * x) + (y * y)); }
-    T magnitude(void){ return std::sqrt((x * x) + (y * y)); }
-    void normalize(void) { T l = length(); if (l > 0.0) { T il = 1.0 / length(); x = x * il; y = y * il; } };
-    vec2_t normalized(void) { T l = length(); return (l > 0.0) ? (vec2_t(x, y) * (1.0 / l)) : vec2_t(x, y); }
+    constexpr uint32 size(void) const { return SIZE; }
+    T length(void) const { return std::sqrt((x * x) + (y * y)); }
+    T magnitude(void) const { return std::sqrt((x * x) + (y * y)); }
+    void normalize(void) { T l = length(); if (l > 0.0) { T il = 1.0 / l; x = x * il; y = y * il; } };
+    vec2_t normalized(void) const { T l = length(); return (l > 0.0) ? (vec2_t(x, y) * (1.0 / l)) : vec2_t(x, y); }
+    T fastLength(void) const { T l2 = (x * x) + (y * y); return (l2 > 0.0) ? l2 * rsqrt(l2) : 0.0; } // relative error, see rsqrt()
+    void fastNormalize(void) { T l2 = (x * x) + (y * y); if (l2 > 0.0) { T il = rsqrt(l2); x = x * il; y = y * il; } }; // unit length within rsqrt() error
     T distance(const vec2_t &_v) const { return std::sqrt(((x - _v.x) * (x - _v.x)) + ((y - _v.y) * (y - _v.y))); }
-    T dot(const vec2_t& _v) const { return x * _v.x + y * _v.y; }
-    T cross(const vec2_t& _v) const { return (x * _v.y) - (y * _v.x); }
-    static T dot(const vec2_t &_v1, const vec2_t &_v2) { T s = (_v1.x * _v2.x) + (_v1.y * _v2.y); return s; }
-    static T cross(const vec2_t &_v1, const vec2_t &_v2) { T f((_v1.x * _v2.y) - (_v1.y * _v2.x)); return f; }
+    constexpr T dot(const vec2_t& _v) const { return x * _v.x + y * _v.y; }
+    constexpr T cross(const vec2_t& _v) const { return (x * _v.y) - (y * _v.x); }
+    static constexpr T dot(const vec2_t &_v1, const vec2_t &_v2) { T s = (_v1.x * _v2.x) + (_v1.y * _v2.y); return s; }
+    static constexpr T cross(const vec2_t &_v1, const vec2_t &_v2) { T f((_v1.x * _v2.y) - (_v1.y * _v2.x)); return f; }
 };
 
 #endif // LIB_MATH_VECTOR_VEC2_HPP
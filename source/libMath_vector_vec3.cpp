@@ -21,4 +21,13 @@
  * @date 2020-04-23
  */
 
-#include "libMath_vector_vec3.hpp"
\ No newline at end of file
+#include "libMath_vector_vec3.hpp"
+
+// compile time evaluation checks
+static_assert((vec3_t<float32>(1.0f, 0.0f, 0.0f) % vec3_t<float32>(0.0f, 1.0f, 0.0f)) == vec3_t<float32>(0.0f, 0.0f, 1.0f));
+static_assert(vec3_t<float32>::dot(vec3_t<float32>(1.0f, 2.0f, 3.0f), vec3_t<float32>(4.0f, 5.0f, 6.0f)) == 32.0f);
+static_assert((vec3_t<float64>(1.0) * 3.0 - vec3_t<float64>(1.0, 2.0, 3.0))[2] == 0.0);
+
+// layout checks, bulkCopy() and GPU uploads rely on these
+static_assert(std::is_trivially_copyable<vec3_t<float32>>::value && std::is_standard_layout<vec3_t<float32>>::value);
+static_assert(std::is_trivially_copyable<vec3_t<float64>>::value && std::is_standard_layout<vec3_t<float64>>::value);
@@ -26,6 +26,7 @@
 
 #include "libMath_defines.hpp"
 #include "libMath_includes.hpp"
+#include "libMath_sqrt.hpp"
 
 template<typename T>
 struct vec3_t
@@ -39,47 +40,49 @@ struct vec3_t
     };
     
     // construnctors and destructor
-    vec3_t<T>(void) { this->x = 0.0; this->y = 0.0; this->z = 0.0; }
-    vec3_t<T>(const T &_f) { this->x = _f; this->y = _f; this->z = _f; }
-    vec3_t<T>(const T &_x, const T &_y, const T &_z) { this->x = _x; this->y = _y; this->z = _z; }
-    vec3_t<T>(const vec3_t<T>& _v) { this->x = _v.x; this->y = _v.y; this->z = _v.z; }
-    ~vec3_t<T>(void) = default;
+    constexpr vec3_t(void) : x(0.0), y(0.0), z(0.0) { }
+    constexpr vec3_t(const T &_f) : x(_f), y(_f), z(_f) { }
+    constexpr vec3_t(const T &_x, const T &_y, const T &_z) : x(_x), y(_y), z(_z) { }
+    constexpr vec3_t(const vec3_t<T>& _v) = default;
+    ~vec3_t(void) = default;
     
     // opperators
-    bool operator==(const vec3_t<T>& _v) const { return (this->x == _v.x && this->y == _v.y && this->z == _v.z); }
-    vec3_t<T>& operator=(const vec3_t<T>& _v) { this->x = _v.x; this->y = _v.y; this->z = _v.z; return *this; }
-    vec3_t<T> operator- (void) const { vec3_t<T> v(-this->x, -this->y, -this->z); return v; }
-    void operator+=(const vec3_t<T>& _v) { this->x += _v.x; this->y += _v.y; this->z += _v.z; }
-    vec3_t<T> operator+(const vec3_t<T>& _v) const { return vec3_t<T>(this->x + _v.x, this->y + _v.y, this->z + _v.z); }
-    void operator-=(const vec3_t<T>& _v) { this->x -= _v.x; this->y -= _v.y; this->z -= _v.z; }
-    vec3_t<T> operator-(const vec3_t<T>& _v) const { return vec3_t<T>(this->x - _v.x, this->y - _v.y, this->z - _v.z); }
-    void operator*=(const T _s) { this->x *= _s; this->y *= _s; this->z *= _s; }
-    vec3_t<T> operator*(const T _s) const {    return vec3_t<T>(_s * this->x, _s * this->y, _s * this->z); }
-    void operator /=(const T _s) { this->x /= _s; this->y /= _s; this->z /= _s; }
-    vec3_t<T> operator/(const T _s) const {return vec3_t<T>(this->x / _s, this->y / _s, this->z / _s); }
-    T operator*(const vec3_t<T>& _v) const { return this->x * _v.x + this->y * _v.y + this->z * _v.z; }
-    void operator %=(const vec3_t<T>& _v) { *this=cross(_v); }
-    vec3_t<T> operator %(const vec3_t<T>& _v) const { return vec3_t<T>(this->y * _v.z - this->z * _v.y, this->z * _v.x - this->x * _v.z, this->x * _v.y - this->y * _v.x); }
-    T& operator[](uint32 _i) { return this->array[_i]; }
-    const T& operator[]( uint32 _i ) const { return this->array[_i]; }
+    constexpr bool operator==(const vec3_t<T>& _v) const { return (this->x == _v.x && this->y == _v.y && this->z == _v.z); }
+    constexpr vec3_t<T>& operator=(const vec3_t<T>& _v) = default;
+    constexpr vec3_t<T> operator- (void) const { vec3_t<T> v(-this->x, -this->y, -this->z); return v; }
+    constexpr void operator+=(const vec3_t<T>& _v) { this->x += _v.x; this->y += _v.y; this->z += _v.z; }
+    constexpr vec3_t<T> operator+(const vec3_t<T>& _v) const { return vec3_t<T>(this->x + _v.x, this->y + _v.y, this->z + _v.z); }
+    constexpr void operator-=(const vec3_t<T>& _v) { this->x -= _v.x; this->y -= _v.y; this->z -= _v.z; }
+    constexpr vec3_t<T> operator-(const vec3_t<T>& _v) const { return vec3_t<T>(this->x - _v.x, this->y - _v.y, this->z - _v.z); }
+    constexpr void operator*=(const T _s) { this->x *= _s; this->y *= _s; this->z *= _s; }
+    constexpr vec3_t<T> operator*(const T _s) const {    return vec3_t<T>(_s * this->x, _s * this->y, _s * this->z); }
+    constexpr void operator /=(const T _s) { this->x /= _s; this->y /= _s; this->z /= _s; }
+    constexpr vec3_t<T> operator/(const T _s) const {return vec3_t<T>(this->x / _s, this->y / _s, this->z / _s); }
+    constexpr T operator*(const vec3_t<T>& _v) const { return this->x * _v.x + this->y * _v.y + this->z * _v.z; }
+    constexpr void operator %=(const vec3_t<T>& _v) { *this=cross(_v); }
+    constexpr vec3_t<T> operator %(const vec3_t<T>& _v) const { return vec3_t<T>(this->y * _v.z - this->z * _v.y, this->z * _v.x - this->x * _v.z, this->x * _v.y - this->y * _v.x); }
+    constexpr T& operator[](uint32 _i) { if (std::is_constant_evaluated()) return (_i == 0) ? this->x : (_i == 1) ? this->y : this->z; return this->array[_i]; }
+    constexpr const T& operator[]( uint32 _i ) const { if (std::is_constant_evaluated()) return (_i == 0) ? this->x : (_i == 1) ? this->y : this->z; return this->array[_i]; }
 
-    friend vec3_t<T> operator+ (const T &_vl, const vec3_t<T> &_vr) { vec3_t<T> v(_vl + _vr.x, _vl + _vr.y, _vl + _vr.z); return v; }
-    friend vec3_t<T> operator- (const T &_vl, const vec3_t<T> &_vr) { vec3_t<T> v(_vl - _vr.x, _vl - _vr.y, _vl - _vr.z); return v; }
-    friend vec3_t<T> operator* (const T &_vl, const vec3_t<T> &_vr) { vec3_t<T> v(_vl * _vr.x, _vl * _vr.y, _vl * _vr.z); return v; }
-    friend vec3_t<T> operator/ (const T &_vl, const vec3_t<T> &_vr) { vec3_t<T> v(_vl / _vr.x, _vl / _vr.y, _vl / _vr.z); return v; }
+    friend constexpr vec3_t<T> operator+ (const T &_vl, const vec3_t<T> &_vr) { vec3_t<T> v(_vl + _vr.x, _vl + _vr.y, _vl + _vr.z); return v; }
+    friend constexpr vec3_t<T> operator- (const T &_vl, const vec3_t<T> &_vr) { vec3_t<T> v(_vl - _vr.x, _vl - _vr.y, _vl - _vr.z); return v; }
+    friend constexpr vec3_t<T> operator* (const T &_vl, const vec3_t<T> &_vr) { vec3_t<T> v(_vl * _vr.x, _vl * _vr.y, _vl * _vr.z); return v; }
+    friend constexpr vec3_t<T> operator/ (const T &_vl, const vec3_t<T> &_vr) { vec3_t<T> v(_vl / _vr.x, _vl / _vr.y, _vl / _vr.z); return v; }
 
     // functions
-    uint32 size(void) { return SIZE; }
-    T length(void){ return std::sqrt((x * x) + (y * y) + (z * z)); }
-    T magnitude(void){ return std::sqrt((x * x) + (y * y) + (z * z)); }
-    void normalize(void) { T l = length(); if (l > 0.0) { T il = 1.0 / length(); x = x * il; y = y * il; z = z * il; } };
-    vec3_t<T> normalized(void) { T l = length(); return (l > 0.0) ? (vec3_t<T>(x, y, z) * (1.0 / l)) : vec3_t<T>(x, y, z); }
+    constexpr uint32 size(void) const { return SIZE; }
+    T length(void) const { return std::sqrt((x * x) + (y * y) + (z * z)); }
+    T magnitude(void) const { return std::sqrt((x * x) + (y * y) + (z * z)); }
+    void normalize(void) { T l = length(); if (l > 0.0) { T il = 1.0 / l; x = x * il; y = y * il; z = z * il; } };
+    vec3_t<T> normalized(void) const { T l = length(); return (l > 0.0) ? (vec3_t<T>(x, y, z) * (1.0 / l)) : vec3_t<T>(x, y, z); }
+    T fastLength(void) const { T l2 = (x * x) + (y * y) + (z * z); return (l2 > 0.0) ? l2 * rsqrt(l2) : 0.0; } // relative error, see rsqrt()
+    void fastNormalize(void) { T l2 = (x * x) + (y * y) + (z * z); if (l2 > 0.0) { T il = rsqrt(l2); x = x * il; y = y * il; z = z * il; } }; // unit length within rsqrt() error
     T distance(const vec3_t<T> &_v) const { return std::sqrt(((x - _v.x) * (x - _v.x)) + ((y - _v.y) * (y - _v.y)) + ((z - _v.z) * (z - _v.z))); }
-    T dot(const vec3_t<T>& _v) const { return x * _v.x + y * _v.y + z * _v.z; }
-    vec3_t<T> cross(const vec3_t<T>& _v) const { return vec3_t<T>( y * _v.z - z * _v.y, z * _v.x - x * _v.z, x * _v.y - y * _v.x); }
+    constexpr T dot(const vec3_t<T>& _v) const { return x * _v.x + y * _v.y + z * _v.z; }
+    constexpr vec3_t<T> cross(const vec3_t<T>& _v) const { return vec3_t<T>( y * _v.z - z * _v.y, z * _v.x - x * _v.z, x * _v.y - y * _v.x); }
 
-    static T dot(const vec3_t<T> &_v1, const vec3_t<T> &_v2) { T s = (_v1.x * _v2.x) + (_v1.y * _v2.y) + (_v1.z * _v2.z); return s; }
-    static vec3_t<T> cross(const vec3_t<T> &_v1, const vec3_t<T> &_v2) { vec3_t<T> v((_v1.y * _v2.z) - (_v1.z * _v2.y), (_v1.z * _v2.x) - (_v1.x * _v2.z), (_v1.x * _v2.y) - (_v1.y * _v2.x)); return v; }
+    static constexpr T dot(const vec3_t<T> &_v1, const vec3_t<T> &_v2) { T s = (_v1.x * _v2.x) + (_v1.y * _v2.y) + (_v1.z * _v2.z); return s; }
+    static constexpr vec3_t<T> cross(const vec3_t<T> &_v1, const vec3_t<T> &_v2) { vec3_t<T> v((_v1.y * _v2.z) - (_v1.z * _v2.y), (_v1.z * _v2.x) - (_v1.x * _v2.z), (_v1.x * _v2.y) - (_v1.y * _v2.x)); return v; }
 };
 
 #endif // LIB_MATH_VECTOR_VEC3_HPP
\ No newline at end of file
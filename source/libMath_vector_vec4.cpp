@@ -21,4 +21,13 @@
  * @date 2020-04-23
  */
 
-#include "libMath_vector_vec4.hpp"
\ No newline at end of file
+#include "libMath_vector_vec4.hpp"
+
+// compile time evaluation checks
+static_assert((vec4_t<float32>(1.0f, 2.0f, 3.0f, 4.0f) * 2.0f) == vec4_t<float32>(2.0f, 4.0f, 6.0f, 8.0f));
+static_assert(vec4_t<float32>(1.0f).dot(vec4_t<float32>(1.0f, 2.0f, 3.0f, 4.0f)) == 10.0f);
+static_assert(sizeof(vec4_t<float32>) == 4 * sizeof(float32));
+
+// layout checks, bulkCopy() and GPU uploads rely on these
+static_assert(std::is_trivially_copyable<vec4_t<float32>>::value && std::is_standard_layout<vec4_t<float32>>::value);
+static_assert(std::is_trivially_copyable<vec4_t<float64>>::value && std::is_standard_layout<vec4_t<float64>>::value);
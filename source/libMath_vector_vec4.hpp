@@ -26,29 +26,36 @@
 
 #include "libMath_defines.hpp"
 #include "libMath_includes.hpp"
+#include "libMath_sqrt.hpp"
 
 template<typename T>
 struct vec4_t
 {
     static const uint32_t SIZE = 4;
-    vec4_t(float64 _f) { x = _f; y = _f; z = _f; w = _f; }
-    vec4_t(float64 _x, float64 _y, float64 _z, float64 _w) { x = _x; y = _y; z = _z; w = _w; }
-    ~vec4_t(void) { }
-    vec4_t(const vec4_t& _v) { x = _v.x; y = _v.y; z = _v.z; w = _v.w; }
-    bool operator==(const vec4_t& _v) { return (x == _v.x && y == _v.y && z == _v.z && w == _v.w); }
-    vec4_t& operator=(const vec4_t& _v) { x = _v.x; y = _v.y; z = _v.z; w = _v.w; return *this; }
-    void operator+=(const vec4_t& _v) { x += _v.x; y += _v.y; z += _v.z; w += _v.w; }
-    vec4_t operator+(const vec4_t& _v) const { return vec4_t(x + _v.x, y + _v.y, z + _v.z, w + _v.w); }
-    void operator-=(const vec4_t& _v) { x -= _v.x; y -= _v.y; z -= _v.z; w -= _v.w; }
-    vec4_t operator-(const vec4_t& _v) const { return vec4_t(x - _v.x, y - _v.y, z - _v.z, w - _v.w); }
-    void operator*=(const float64 _s) { x *= _s; y *= _s; z *= _s; w *= _s; }
-    vec4_t operator*(const float64 _s) const {    return vec4_t(_s * x, _s * y, _s * z, _s * w); }
-    void operator /=(const float64 _s) { x /= _s; y /= _s; z /= _s; w /= _s; }
-    vec4_t operator/(const float64 _s) const {return vec4_t(x / _s, y / _s, z / _s, w / _s); }
-    float64 operator*(const vec4_t& _v) const { return x * _v.x + y * _v.y + z * _v.z + w * _v.w; }
-    float64 dot(const vec4_t& _v) const { return x * _v.x + y * _v.y + z * _v.z + w * _v.w; }
-    float64 magnitude(void){ return std::sqrt(x * x + y * y + z * z + w * w); }
-    void normalize(void) { float64 magnitude = std::sqrt(x * x + y * y + z * z + w * w);  if (magnitude > 0.0f) { float64 oneOverMagnitude = 1.0f / magnitude; x = x * oneOverMagnitude; y = y * oneOverMagnitude; z = z * oneOverMagnitude; w = w * oneOverMagnitude; } }
+    constexpr vec4_t(void) : x(0.0), y(0.0), z(0.0), w(0.0) { }
+    constexpr vec4_t(T _f) : x(_f), y(_f), z(_f), w(_f) { }
+    constexpr vec4_t(T _x, T _y, T _z, T _w) : x(_x), y(_y), z(_z), w(_w) { }
+    ~vec4_t(void) = default;
+    constexpr vec4_t(const vec4_t& _v) = default;
+    constexpr bool operator==(const vec4_t& _v) const { return (x == _v.x && y == _v.y && z == _v.z && w == _v.w); }
+    constexpr vec4_t& operator=(const vec4_t& _v) = default;
+    constexpr void operator+=(const vec4_t& _v) { x += _v.x; y += _v.y; z += _v.z; w += _v.w; }
+    constexpr vec4_t operator+(const vec4_t& _v) const { return vec4_t(x + _v.x, y + _v.y, z + _v.z, w + _v.w); }
+    constexpr void operator-=(const vec4_t& _v) { x -= _v.x; y -= _v.y; z -= _v.z; w -= _v.w; }
+    constexpr vec4_t operator-(const vec4_t& _v) const { return vec4_t(x - _v.x, y - _v.y, z - _v.z, w - _v.w); }
+    constexpr vec4_t operator-(void) const { return vec4_t(-x, -y, -z, -w); }
+    constexpr void operator*=(const T _s) { x *= _s; y *= _s; z *= _s; w *= _s; }
+    constexpr vec4_t operator*(const T _s) const {    return vec4_t(_s * x, _s * y, _s * z, _s * w); }
+    constexpr void operator /=(const T _s) { x /= _s; y /= _s; z /= _s; w /= _s; }
+    constexpr vec4_t operator/(const T _s) const {return vec4_t(x / _s, y / _s, z / _s, w / _s); }
+    constexpr T operator*(const vec4_t& _v) const { return x * _v.x + y * _v.y + z * _v.z + w * _v.w; }
+    constexpr T& operator[](uint32 _i) { if (std::is_constant_evaluated()) return (_i == 0) ? x : (_i == 1) ? y : (_i == 2) ? z : w; return array[_i]; }
+    constexpr const T& operator[](uint32 _i) const { if (std::is_constant_evaluated()) return (_i == 0) ? x : (_i == 1) ? y : (_i == 2) ? z : w; return array[_i]; }
+    constexpr T dot(const vec4_t& _v) const { return x * _v.x + y * _v.y + z * _v.z + w * _v.w; }
+    T magnitude(void) const { return std::sqrt(x * x + y * y + z * z + w * w); }
+    T fastLength(void) const { T l2 = x * x + y * y + z * z + w * w; return (l2 > 0.0f) ? l2 * rsqrt(l2) : 0.0f; } // relative error, see rsqrt()
+    void normalize(void) { T magnitude = std::sqrt(x * x + y * y + z * z + w * w);  if (magnitude > 0.0f) { T oneOverMagnitude = 1.0f / magnitude; x = x * oneOverMagnitude; y = y * oneOverMagnitude; z = z * oneOverMagnitude; w = w * oneOverMagnitude; } }
+    void fastNormalize(void) { T l2 = x * x + y * y + z * z + w * w; if (l2 > 0.0f) { T oneOverMagnitude = rsqrt(l2); x = x * oneOverMagnitude; y = y * oneOverMagnitude; z = z * oneOverMagnitude; w = w * oneOverMagnitude; } } // unit length within rsqrt() error
 
 /*  -- internal test code ---
     void draw(void)
@@ -64,8 +71,8 @@ struct vec4_t
 
     union
     {
-        struct { float64 x = 0.0f; float64 y = 0.0f; float64 z = 0.0f; float64 w = 0.0f; };
-        struct { float64 array[SIZE]; };
+        struct { T x = 0.0f; T y = 0.0f; T z = 0.0f; T w = 0.0f; };
+        struct { T array[SIZE]; };
     };
 };
 
@@ -0,0 +1,407 @@
+/**
+ * Copyright (C) Paul Wortmann, PhysHex Games, www.physhexgames.com
+ * This file is part of "libMath"
+ *
+ * "libMath" is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 only.
+ *
+ * "libMath" is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with "libMath" If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author  Paul Wortmann
+ * @email   physhex@gmail.com
+ * @website www.physhexgames.com
+ * @license GPL V2
+ * @date 2026-10-19
+ */
+
+#ifndef LIB_MATH_WELD_HPP
+#define LIB_MATH_WELD_HPP
+
+#include "libMath_defines.hpp"
+#include "libMath_includes.hpp"
+#include "libMath_parallel.hpp"
+#include "libMath_vector.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+#define LIB_MATH_WELD_GRAIN 8192 // minimum vertices / cells per thread
+
+// Vertex welding: positions are quantized to cells of edge _tolerance, vertices in the same cell
+// are candidates. Cells go into an open addressing table of 2^n slots (at least twice the vertex
+// count, sized before the parallel insert), each slot remembers the first vertex inserted for its
+// cell. Every cell is then welded on one thread: in index order each vertex joins the first
+// earlier kept vertex of its cell whose attributes all differ by at most _attributeEpsilon,
+// otherwise it is kept. Vertices kept by their cell then go into a second table of cells of edge
+// 4 * _tolerance, so points on either side of a cell border are merged too: a vertex joins the
+// lowest index earlier kept vertex that is within _tolerance on every axis, has matching
+// attributes and stays kept itself. These joins are resolved in ascending index order, so a
+// chain of vertices each within _tolerance of the next keeps every other one. Vertices welded by
+// their cell follow their cell's kept vertex, so they may end up up to 2 * _tolerance per axis
+// away from the vertex they merge into. Kept vertices are numbered in index order, so the result
+// does not depend on the thread count.
+
+// functions
+
+inline uint32 weldHash(const int32 _x, const int32 _y, const int32 _z)
+{
+    uint32 h = (static_cast<uint32>(_x) * 0x8da6b343u) ^ (static_cast<uint32>(_y) * 0xd8163841u) ^ (static_cast<uint32>(_z) * 0xcb1ab31fu);
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    return h;
+}
+
+// _remap[i] receives the welded index of vertex i, _kept (optional) the original index of every
+// welded vertex, returns the welded vertex count. _attributes holds _attributeCount values per
+// vertex or is nullptr. At most 2^31 - 1 vertices.
+template<typename T>
+size_t weldVertices(const vec3_t<T> *_positions, const size_t _count, const T _tolerance, const T *_attributes, const uint32 _attributeCount, const T _attributeEpsilon, uint32 *_remap, std::vector<uint32> *_kept = nullptr)
+{
+    const uint32 empty = ~0u;
+    uint32 bits = 1;
+    while (((static_cast<size_t>(1) << bits) < (_count * 2)) && (bits < 31))
+    {
+        bits++;
+    }
+    const uint32 slotCount = 1u << bits;
+    const uint32 mask      = slotCount - 1;
+    std::vector<int32> cell(_count * 3);
+    std::vector<uint32> slots(slotCount, empty);
+    std::vector<uint32> slotOf(_count);
+    const T scale = static_cast<T>(1.0) / _tolerance;
+    constexpr T limit = static_cast<T>(1 << 30); // keeps far away (or NaN) positions representable
+    auto quantize = [&](const T _v) -> int32
+    {
+        const T f = std::floor(_v * scale);
+        return static_cast<int32>((f > -limit) ? ((f < limit) ? f : limit) : -limit);
+    };
+    auto inCell = [&](const uint32 _v, const int32 _x, const int32 _y, const int32 _z)
+    {
+        return (cell[(static_cast<size_t>(_v) * 3) + 0] == _x) && (cell[(static_cast<size_t>(_v) * 3) + 1] == _y) && (cell[(static_cast<size_t>(_v) * 3) + 2] == _z);
+    };
+    auto attributesMatch = [&](const uint32 _a, const uint32 _b)
+    {
+        bool match = true;
+        for (uint32 a = 0; (a < _attributeCount) && match && (_attributes != nullptr); a++)
+        {
+            match = std::fabs(_attributes[(static_cast<size_t>(_a) * _attributeCount) + a] - _attributes[(static_cast<size_t>(_b) * _attributeCount) + a]) <= _attributeEpsilon;
+        }
+        return match;
+    };
+    // quantize, then insert every cell
+    parallelFor(_count, LIB_MATH_WELD_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            for (uint32 k = 0; k < 3; k++)
+            {
+                cell[(i * 3) + k] = quantize(_positions[i][k]);
+            }
+        }
+    });
+    parallelFor(_count, LIB_MATH_WELD_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            const int32 x = cell[(i * 3) + 0];
+            const int32 y = cell[(i * 3) + 1];
+            const int32 z = cell[(i * 3) + 2];
+            uint32 s = weldHash(x, y, z) & mask;
+            while (true)
+            {
+                uint32 current = empty;
+                if (std::atomic_ref<uint32>(slots[s]).compare_exchange_strong(current, static_cast<uint32>(i), std::memory_order_acq_rel) || inCell(current, x, y, z))
+                {
+                    break;
+                }
+                s = (s + 1) & mask;
+            }
+            slotOf[i] = s;
+        }
+    });
+    // members of every slot in index order (counting sort)
+    std::vector<uint32> start(static_cast<size_t>(slotCount) + 1, 0);
+    std::vector<uint32> members(_count);
+    for (size_t i = 0; i < _count; i++)
+    {
+        start[slotOf[i] + 1]++;
+    }
+    for (uint32 s = 0; s < slotCount; s++)
+    {
+        start[s + 1] += start[s];
+    }
+    {
+        std::vector<uint32> cursor(start.begin(), start.end() - 1);
+        for (size_t i = 0; i < _count; i++)
+        {
+            members[cursor[slotOf[i]]++] = static_cast<uint32>(i);
+        }
+    }
+    // weld every cell, keptOf[i] is the kept vertex vertex i merges into
+    std::vector<uint32> keptOf(_count);
+    parallelFor(slotCount, LIB_MATH_WELD_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        std::vector<uint32> kept;
+        for (size_t s = _begin; s < _end; s++)
+        {
+            kept.clear();
+            for (uint32 m = start[s]; m < start[s + 1]; m++)
+            {
+                const uint32 i = members[m];
+                uint32 target = i;
+                for (const uint32 k : kept)
+                {
+                    if (attributesMatch(i, k))
+                    {
+                        target = k;
+                        break;
+                    }
+                }
+                if (target == i)
+                {
+                    kept.push_back(i);
+                }
+                keptOf[i] = target;
+            }
+        }
+    });
+    // Vertices kept by their cell are grouped again on cells of 4 * _tolerance, the points within
+    // _tolerance of a vertex lie in the one or two of these cells per axis that cover its
+    // neighbouring cells. Slots carry their cell and member range and members their position, so
+    // a lookup touches one slot and one run of members.
+    struct parentSlot_t { int32 x, y, z; uint32 first, begin, end; };
+    struct parentMember_t { vec3_t<T> p; uint32 index; };
+    std::vector<parentSlot_t> parents(slotCount, parentSlot_t{ 0, 0, 0, empty, 0, 0 });
+    parallelFor(_count, LIB_MATH_WELD_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            if (keptOf[i] != i)
+            {
+                continue;
+            }
+            const int32 x = cell[(i * 3) + 0] >> 2;
+            const int32 y = cell[(i * 3) + 1] >> 2;
+            const int32 z = cell[(i * 3) + 2] >> 2;
+            uint32 s = weldHash(x, y, z) & mask;
+            while (true)
+            {
+                uint32 current = empty;
+                if (std::atomic_ref<uint32>(parents[s].first).compare_exchange_strong(current, static_cast<uint32>(i), std::memory_order_acq_rel) ||
+                    (((cell[(static_cast<size_t>(current) * 3) + 0] >> 2) == x) && ((cell[(static_cast<size_t>(current) * 3) + 1] >> 2) == y) && ((cell[(static_cast<size_t>(current) * 3) + 2] >> 2) == z)))
+                {
+                    break;
+                }
+                s = (s + 1) & mask;
+            }
+            slotOf[i] = s;
+        }
+    });
+    std::fill(start.begin(), start.end(), 0);
+    for (size_t i = 0; i < _count; i++)
+    {
+        start[slotOf[i] + 1] += (keptOf[i] == i) ? 1 : 0;
+    }
+    for (uint32 s = 0; s < slotCount; s++)
+    {
+        start[s + 1] += start[s];
+    }
+    parallelFor(slotCount, LIB_MATH_WELD_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t s = _begin; s < _end; s++)
+        {
+            if (parents[s].first != empty)
+            {
+                parents[s].x     = cell[(static_cast<size_t>(parents[s].first) * 3) + 0] >> 2;
+                parents[s].y     = cell[(static_cast<size_t>(parents[s].first) * 3) + 1] >> 2;
+                parents[s].z     = cell[(static_cast<size_t>(parents[s].first) * 3) + 2] >> 2;
+                parents[s].begin = start[s];
+                parents[s].end   = start[s + 1];
+            }
+        }
+    });
+    std::vector<parentMember_t> parentMembers(start[slotCount]);
+    std::vector<uint32> memberOf(_count);
+    {
+        std::vector<uint32> cursor(start.begin(), start.end() - 1);
+        for (size_t i = 0; i < _count; i++)
+        {
+            if (keptOf[i] == i)
+            {
+                memberOf[i] = cursor[slotOf[i]];
+                parentMembers[cursor[slotOf[i]]++] = parentMember_t{ _positions[i], static_cast<uint32>(i) };
+            }
+        }
+    }
+    // parent cells that may hold candidates of member _m, one or two per axis, returns their count
+    auto around = [&](const uint32 _m, int32 (&_cells)[8][3]) -> uint32
+    {
+        int32 lo[3];
+        int32 hi[3];
+        for (uint32 k = 0; k < 3; k++)
+        {
+            const int32 c = quantize(parentMembers[_m].p[k]);
+            lo[k] = (c - 1) >> 2;
+            hi[k] = (c + 1) >> 2;
+        }
+        uint32 count = 0;
+        for (int32 z = lo[2]; z <= hi[2]; z++)
+        {
+            for (int32 y = lo[1]; y <= hi[1]; y++)
+            {
+                for (int32 x = lo[0]; x <= hi[0]; x++)
+                {
+                    _cells[count][0] = x;
+                    _cells[count][1] = y;
+                    _cells[count][2] = z;
+                    count++;
+                }
+            }
+        }
+        return count;
+    };
+    // slot of a parent cell, or an empty one
+    auto find = [&](const int32 _x, const int32 _y, const int32 _z) -> uint32
+    {
+        uint32 s = weldHash(_x, _y, _z) & mask;
+        while ((parents[s].first != empty) && ((parents[s].x != _x) || (parents[s].y != _y) || (parents[s].z != _z)))
+        {
+            s = (s + 1) & mask;
+        }
+        return s;
+    };
+    // _func(position) for every member of an earlier vertex within _tolerance of member _m on every
+    // axis with matching attributes, _slot is the slot of _m's own cell
+    auto neighbours = [&](const uint32 _slot, const uint32 _m, auto &&_func)
+    {
+        int32 cells[8][3];
+        const vec3_t<T> p = parentMembers[_m].p;
+        const uint32 i = parentMembers[_m].index;
+        const uint32 count = around(_m, cells);
+        for (uint32 n = 0; n < count; n++)
+        {
+            const int32 x = cells[n][0];
+            const int32 y = cells[n][1];
+            const int32 z = cells[n][2];
+            const uint32 s = ((parents[_slot].x == x) && (parents[_slot].y == y) && (parents[_slot].z == z)) ? _slot : find(x, y, z);
+            for (uint32 m = parents[s].begin; (parents[s].first != empty) && (m < parents[s].end) && (parentMembers[m].index < i); m++)
+            {
+                const vec3_t<T> &q = parentMembers[m].p;
+                if ((std::fabs(p.x - q.x) <= _tolerance) && (std::fabs(p.y - q.y) <= _tolerance) && (std::fabs(p.z - q.z) <= _tolerance) && attributesMatch(i, parentMembers[m].index))
+                {
+                    _func(m);
+                }
+            }
+        }
+    };
+    // Per member: lead is the lowest candidate (found in parallel), joins the lowest candidate that
+    // stays kept, or empty if the member stays kept itself. Joins are resolved in ascending index
+    // order, so every candidate is final when it is looked at. A member whose lead stays kept
+    // joins it directly, the others scan their candidates again.
+    std::vector<uint32> lead(parentMembers.size(), empty);
+    std::vector<uint32> joins(parentMembers.size(), empty);
+    parallelFor(slotCount, LIB_MATH_WELD_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t s = _begin; s < _end; s++)
+        {
+            for (uint32 m = parents[s].begin; (parents[s].first != empty) && (m < parents[s].end); m++)
+            {
+                neighbours(static_cast<uint32>(s), m, [&](const uint32 _k) { lead[m] = ((lead[m] == empty) || (parentMembers[_k].index < parentMembers[lead[m]].index)) ? _k : lead[m]; });
+            }
+        }
+    });
+    for (size_t i = 0; i < _count; i++)
+    {
+        const uint32 m = memberOf[i];
+        if ((keptOf[i] != i) || (lead[m] == empty))
+        {
+            continue;
+        }
+        if (joins[lead[m]] == empty)
+        {
+            joins[m] = lead[m];
+            continue;
+        }
+        neighbours(slotOf[i], m, [&](const uint32 _k)
+        {
+            joins[m] = ((joins[_k] == empty) && ((joins[m] == empty) || (parentMembers[_k].index < parentMembers[joins[m]].index))) ? _k : joins[m];
+        });
+    }
+    parallelFor(_count, LIB_MATH_WELD_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            const uint32 j = joins[memberOf[keptOf[i]]];
+            if (j != empty)
+            {
+                keptOf[i] = parentMembers[j].index;
+            }
+        }
+    });
+    // number the kept vertices in index order
+    const size_t chunks = std::max<size_t>(1, std::min<size_t>(parallelThreadCount(), _count / LIB_MATH_WELD_GRAIN));
+    std::vector<uint32> chunkKept(chunks + 1, 0);
+    parallelFor(chunks, 1, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t c = _begin; c < _end; c++)
+        {
+            uint32 n = 0;
+            const size_t end = (_count * (c + 1)) / chunks;
+            for (size_t i = (_count * c) / chunks; i < end; i++)
+            {
+                n += (keptOf[i] == i) ? 1 : 0;
+            }
+            chunkKept[c + 1] = n;
+        }
+    });
+    for (size_t c = 0; c < chunks; c++)
+    {
+        chunkKept[c + 1] += chunkKept[c];
+    }
+    if (_kept != nullptr)
+    {
+        _kept->resize(chunkKept[chunks]);
+    }
+    parallelFor(chunks, 1, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t c = _begin; c < _end; c++)
+        {
+            uint32 n = chunkKept[c];
+            const size_t end = (_count * (c + 1)) / chunks;
+            for (size_t i = (_count * c) / chunks; i < end; i++)
+            {
+                if (keptOf[i] == i)
+                {
+                    if (_kept != nullptr)
+                    {
+                        (*_kept)[n] = static_cast<uint32>(i);
+                    }
+                    _remap[i] = n++;
+                }
+            }
+        }
+    });
+    parallelFor(_count, LIB_MATH_WELD_GRAIN, [&](const size_t _begin, const size_t _end)
+    {
+        for (size_t i = _begin; i < _end; i++)
+        {
+            if (keptOf[i] != i)
+            {
+                _remap[i] = _remap[keptOf[i]];
+            }
+        }
+    });
+    return chunkKept[chunks];
+}
+
+#endif // LIB_MATH_WELD_HPP